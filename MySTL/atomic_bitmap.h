@@ -0,0 +1,153 @@
+#ifndef MYSTL_ATOMIC_BITMAP_H
+#define MYSTL_ATOMIC_BITMAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+#include "bitmap.h"
+#include "thread_pool.h"
+
+namespace MySTL {
+
+/*====================================================
+    λͼ̶ڶ߷ʱ·
+    ޸Ķ 64 λϵԭ fetch_or / fetch_and
+    ʺΪб visited 
+====================================================*/
+class AtomicBitmap {
+private:
+    std::unique_ptr<std::atomic<uint64_t>[]> _words;
+    size_t _nwords;
+    size_t _nbits;
+
+    // ֹ
+    AtomicBitmap(const AtomicBitmap&);
+    AtomicBitmap& operator=(const AtomicBitmap&);
+
+public:
+    static const size_t npos = (size_t)-1;
+
+    explicit AtomicBitmap(size_t nbits)
+        : _words(new std::atomic<uint64_t>[(nbits + 63) / 64]), _nwords((nbits + 63) / 64), _nbits(nbits) {
+        for (size_t i = 0; i < _nwords; ++i) _words[i].store(0, std::memory_order_relaxed);
+    }
+
+    size_t size() const {
+        return _nbits;
+    }
+
+    size_t wordCount() const {
+        return _nwords;
+    }
+
+    bool test(size_t k) const {
+        return (_words[k >> 6].load(std::memory_order_acquire) >> (k & 63)) & 1;
+    }
+
+    // λԭֵȶһΣλͲԭдٻ
+    bool testAndSet(size_t k) {
+        uint64_t bit = 1ULL << (k & 63);
+        std::atomic<uint64_t>& w = _words[k >> 6];
+        if (w.load(std::memory_order_relaxed) & bit) return true;
+        return (w.fetch_or(bit, std::memory_order_acq_rel) & bit) != 0;
+    }
+
+    void set(size_t k) {
+        _words[k >> 6].fetch_or(1ULL << (k & 63), std::memory_order_acq_rel);
+    }
+
+    // λԭֵ
+    bool testAndClear(size_t k) {
+        uint64_t bit = 1ULL << (k & 63);
+        return (_words[k >> 6].fetch_and(~bit, std::memory_order_acq_rel) & bit) != 0;
+    }
+
+    // Ե w  fetch_orؾֵ
+    uint64_t fetchOr(size_t w, uint64_t mask) {
+        return _words[w].fetch_or(mask, std::memory_order_acq_rel);
+    }
+
+    uint64_t loadWord(size_t w) const {
+        return _words[w].load(std::memory_order_acquire);
+    }
+
+    /*------------------------------------------------
+        λͬһλڼĴϲ
+        ÿֻһ fetch_oridx ʱϲЧá
+        رλĸnewly ǿʱλ±
+    ------------------------------------------------*/
+    size_t setBatch(const size_t* idx, size_t n, std::vector<size_t>* newly = nullptr) {
+        size_t added = 0;
+        for (size_t i = 0; i < n;) {
+            size_t w = idx[i] >> 6;
+            uint64_t mask = 0;
+            while (i < n && (idx[i] >> 6) == w) mask |= 1ULL << (idx[i++] & 63);
+            uint64_t old = _words[w].load(std::memory_order_relaxed);
+            if ((old & mask) != mask) old = _words[w].fetch_or(mask, std::memory_order_acq_rel);
+            uint64_t gained = mask & ~old;
+            added += popcount64(gained);
+            if (newly) {
+                while (gained) {
+                    newly->push_back((w << 6) + ctz64(gained));
+                    gained &= gained - 1;
+                }
+            }
+        }
+        return added;
+    }
+
+    // λҲֺܰϲ
+    size_t setBatchUnsorted(std::vector<size_t>& idx, std::vector<size_t>* newly = nullptr) {
+        std::sort(idx.begin(), idx.end());
+        return idx.empty() ? 0 : setBatch(&idx[0], idx.size(), newly);
+    }
+
+    // ͳλд߲ʱΪĳһʱ̸Ľֵ
+    size_t count(ThreadPool* pool = nullptr) const {
+        if (!pool || pool->size() == 1) {
+            size_t c = 0;
+            for (size_t i = 0; i < _nwords; ++i) c += popcount64(_words[i].load(std::memory_order_relaxed));
+            return c;
+        }
+        std::vector<size_t> part(pool->size(), 0);
+        pool->parallelFor(_nwords, 1 << 14, [&](size_t b, size_t e, int tid) {
+            size_t c = 0;
+            for (size_t i = b; i < e; ++i) c += popcount64(_words[i].load(std::memory_order_relaxed));
+            part[tid] += c;
+        });
+        size_t c = 0;
+        for (size_t t = 0; t < part.size(); ++t) c += part[t];
+        return c;
+    }
+
+    // ȫ㣨̵߳Ķд
+    void reset(ThreadPool* pool = nullptr) {
+        if (!pool) {
+            for (size_t i = 0; i < _nwords; ++i) _words[i].store(0, std::memory_order_relaxed);
+            return;
+        }
+        pool->parallelFor(_nwords, 1 << 14, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) _words[i].store(0, std::memory_order_relaxed);
+        });
+    }
+
+    //  >= pos ĵһλû򷵻 npos
+    size_t findNext(size_t pos) const {
+        if (pos >= _nbits) return npos;
+        size_t w = pos >> 6;
+        uint64_t x = loadWord(w) & (~0ULL << (pos & 63));
+        while (x == 0) {
+            if (++w >= _nwords) return npos;
+            x = loadWord(w);
+        }
+        return (w << 6) + ctz64(x);
+    }
+};
+
+} // namespace MySTL
+
+#endif
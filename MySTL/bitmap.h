@@ -0,0 +1,345 @@
+#ifndef MYSTL_BITMAP_H
+#define MYSTL_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace MySTL {
+
+/*====================================================
+    λСߣӲָʱΪ popcnt / tzcnt
+====================================================*/
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return (int)__popcnt64(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// x != 0
+inline int ctz64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long i;
+    _BitScanForward64(&i, x);
+    return (int)i;
+#else
+    int n = 0;
+    while (!(x & 1)) { x >>= 1; n++; }
+    return n;
+#endif
+}
+
+// x != 0λ֮ϵ 0 ĸ
+inline int clz64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long i;
+    _BitScanReverse64(&i, x);
+    return 63 - (int)i;
+#else
+    int n = 0;
+    while (!(x & 0x8000000000000000ULL)) { x <<= 1; n++; }
+    return n;
+#endif
+}
+
+// ڵ k  0 ƣλλãk < popcount64(x)
+inline int selectInWord(uint64_t x, int k) {
+#if defined(__BMI2__)
+    return ctz64(_pdep_u64(1ULL << k, x));
+#else
+    for (int i = 0; i < k; ++i) x &= x - 1;
+    return ctz64(x);
+#endif
+}
+
+/*====================================================
+    64 λλͼ k λ _words[k >> 6] ĵ (k & 63) λλȣ
+    ̶Խɵ֤߱
+====================================================*/
+class Bitmap {
+private:
+    std::vector<uint64_t> _words;
+    size_t _nbits;
+
+    // һг _nbits λ֤ count() ȲӰ
+    void trimTail() {
+        if (_nbits & 63) _words.back() &= (1ULL << (_nbits & 63)) - 1;
+    }
+
+    // Ԫ㣬AVX2 һδ 4 
+    template<typename Op>
+    void combine(const Bitmap& other, Op op) {
+        size_t n = std::min(_words.size(), other._words.size());
+        uint64_t* a = _words.empty() ? nullptr : &_words[0];
+        const uint64_t* b = other._words.empty() ? nullptr : &other._words[0];
+        size_t i = 0;
+#ifdef __AVX2__
+        for (; i + 4 <= n; i += 4) {
+            __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+            __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+            _mm256_storeu_si256((__m256i*)(a + i), op(x, y));
+        }
+#endif
+        for (; i < n; ++i) a[i] = op(a[i], b[i]);
+    }
+
+    struct AndOp {
+        uint64_t operator()(uint64_t x, uint64_t y) const { return x & y; }
+#ifdef __AVX2__
+        __m256i operator()(__m256i x, __m256i y) const { return _mm256_and_si256(x, y); }
+#endif
+    };
+    struct OrOp {
+        uint64_t operator()(uint64_t x, uint64_t y) const { return x | y; }
+#ifdef __AVX2__
+        __m256i operator()(__m256i x, __m256i y) const { return _mm256_or_si256(x, y); }
+#endif
+    };
+    struct XorOp {
+        uint64_t operator()(uint64_t x, uint64_t y) const { return x ^ y; }
+#ifdef __AVX2__
+        __m256i operator()(__m256i x, __m256i y) const { return _mm256_xor_si256(x, y); }
+#endif
+    };
+    struct AndNotOp {
+        uint64_t operator()(uint64_t x, uint64_t y) const { return x & ~y; }
+#ifdef __AVX2__
+        // _mm256_andnot_si256(a, b) = ~a & b
+        __m256i operator()(__m256i x, __m256i y) const { return _mm256_andnot_si256(y, x); }
+#endif
+    };
+
+public:
+    static const size_t npos = (size_t)-1;
+
+    explicit Bitmap(size_t nbits = 0) : _words((nbits + 63) / 64, 0), _nbits(nbits) {}
+
+    // ıλΪ 0
+    void resize(size_t nbits) {
+        _words.resize((nbits + 63) / 64, 0);
+        _nbits = nbits;
+        if (!_words.empty()) trimTail();
+    }
+
+    size_t size() const {
+        return _nbits;
+    }
+
+    size_t wordCount() const {
+        return _words.size();
+    }
+
+    const uint64_t* words() const {
+        return _words.empty() ? nullptr : &_words[0];
+    }
+
+    uint64_t* words() {
+        return _words.empty() ? nullptr : &_words[0];
+    }
+
+    void set(size_t k) {
+        _words[k >> 6] |= 1ULL << (k & 63);
+    }
+
+    void clear(size_t k) {
+        _words[k >> 6] &= ~(1ULL << (k & 63));
+    }
+
+    bool test(size_t k) const {
+        return (_words[k >> 6] >> (k & 63)) & 1;
+    }
+
+    void reset() {
+        std::fill(_words.begin(), _words.end(), 0);
+    }
+
+    // λ [lo, hi)β룬м
+    void setRange(size_t lo, size_t hi) {
+        if (lo >= hi) return;
+        size_t wl = lo >> 6, wh = (hi - 1) >> 6;
+        uint64_t ml = ~0ULL << (lo & 63);
+        uint64_t mh = ~0ULL >> (63 - ((hi - 1) & 63));
+        if (wl == wh) {
+            _words[wl] |= ml & mh;
+            return;
+        }
+        _words[wl] |= ml;
+        std::fill(_words.begin() + wl + 1, _words.begin() + wh, ~0ULL);
+        _words[wh] |= mh;
+    }
+
+    //  [lo, hi)
+    void clearRange(size_t lo, size_t hi) {
+        if (lo >= hi) return;
+        size_t wl = lo >> 6, wh = (hi - 1) >> 6;
+        uint64_t ml = ~0ULL << (lo & 63);
+        uint64_t mh = ~0ULL >> (63 - ((hi - 1) & 63));
+        if (wl == wh) {
+            _words[wl] &= ~(ml & mh);
+            return;
+        }
+        _words[wl] &= ~ml;
+        std::fill(_words.begin() + wl + 1, _words.begin() + wh, 0ULL);
+        _words[wh] &= ~mh;
+    }
+
+    // λ4 ·ۼö popcnt 
+    size_t count() const {
+        size_t n = _words.size();
+        size_t n4 = n & ~(size_t)3;   // д i + 4 <= n ʱ GCC Խ
+        size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+        for (; i < n4; i += 4) {
+            c0 += popcount64(_words[i]);
+            c1 += popcount64(_words[i + 1]);
+            c2 += popcount64(_words[i + 2]);
+            c3 += popcount64(_words[i + 3]);
+        }
+        for (; i < n; ++i) c0 += popcount64(_words[i]);
+        return c0 + c1 + c2 + c3;
+    }
+
+    //  >= pos ĵһλû򷵻 npos
+    size_t findNext(size_t pos) const {
+        if (pos >= _nbits) return npos;
+        size_t w = pos >> 6;
+        uint64_t x = _words[w] & (~0ULL << (pos & 63));
+        while (x == 0) {
+            if (++w >= _words.size()) return npos;
+            x = _words[w];
+        }
+        return (w << 6) + ctz64(x);
+    }
+
+    size_t findFirst() const {
+        return findNext(0);
+    }
+
+    // ζÿλ visit(k)
+    template<typename VST>
+    void forEach(VST visit) const {
+        for (size_t w = 0; w < _words.size(); ++w) {
+            uint64_t x = _words[w];
+            while (x) {
+                visit((w << 6) + ctz64(x));
+                x &= x - 1;
+            }
+        }
+    }
+
+    // λ㣬н϶̵Уʱ o ûеΪ 0һ
+    Bitmap& operator&=(const Bitmap& o) {
+        combine(o, AndOp());
+        if (o._words.size() < _words.size())
+            std::fill(_words.begin() + o._words.size(), _words.end(), (uint64_t)0);
+        return *this;
+    }
+    Bitmap& operator|=(const Bitmap& o) { combine(o, OrOp()); trimTail(); return *this; }
+    Bitmap& operator^=(const Bitmap& o) { combine(o, XorOp()); trimTail(); return *this; }
+    Bitmap& andNot(const Bitmap& o) { combine(o, AndNotOp()); return *this; }
+
+    bool operator==(const Bitmap& o) const {
+        return _nbits == o._nbits && _words == o._words;
+    }
+};
+
+/*====================================================
+    rank/select λͼֻʱʹã
+    ÿ 512 λ8 ֣һ飬¼֮ǰλ
+      rank1(i) =  +  8  popcnt
+    ÿ 4096 λһڳ飬select ڲ
+====================================================*/
+class BitmapRank {
+private:
+    const Bitmap* _bm;
+    std::vector<uint64_t> _super;     // _super[s] = ǰ s λ
+    std::vector<uint32_t> _sample;    //  j*4096 λڳ
+    size_t _ones;
+
+    static const size_t SUPER_WORDS = 8;
+    static const size_t SAMPLE_RATE = 4096;
+
+public:
+    explicit BitmapRank(const Bitmap& bm) : _bm(&bm), _ones(0) {
+        build();
+    }
+
+    // λͼݱ仯ؽ
+    void build() {
+        const uint64_t* w = _bm->words();
+        size_t nw = _bm->wordCount();
+        size_t ns = (nw + SUPER_WORDS - 1) / SUPER_WORDS;
+        _super.assign(ns + 1, 0);
+        _sample.clear();
+        uint64_t acc = 0;
+        for (size_t s = 0; s < ns; ++s) {
+            _super[s] = acc;
+            uint64_t c = 0;
+            size_t end = std::min(nw, (s + 1) * SUPER_WORDS);
+            for (size_t i = s * SUPER_WORDS; i < end; ++i) c += popcount64(w[i]);
+            while (_sample.size() * SAMPLE_RATE < acc + c) _sample.push_back((uint32_t)s);
+            acc += c;
+        }
+        _super[ns] = acc;
+        _ones = (size_t)acc;
+    }
+
+    size_t ones() const {
+        return _ones;
+    }
+
+    // [0, i) λ
+    size_t rank1(size_t i) const {
+        const uint64_t* w = _bm->words();
+        size_t wi = i >> 6;
+        size_t s = wi / SUPER_WORDS;
+        size_t r = (size_t)_super[s];
+        for (size_t k = s * SUPER_WORDS; k < wi; ++k) r += popcount64(w[k]);
+        if (i & 63) r += popcount64(w[wi] & ((1ULL << (i & 63)) - 1));
+        return r;
+    }
+
+    size_t rank0(size_t i) const {
+        return i - rank1(i);
+    }
+
+    //  k  0 ƣλλãk >= ones() ʱ npos
+    size_t select1(size_t k) const {
+        if (k >= _ones) return Bitmap::npos;
+        // Ŀ곬֮䣬ֲ
+        size_t j = k / SAMPLE_RATE;
+        size_t lo = _sample[j];
+        size_t hi = j + 1 < _sample.size() ? _sample[j + 1] + 1 : _super.size() - 1;
+        size_t s = std::upper_bound(_super.begin() + lo, _super.begin() + hi, (uint64_t)k) - _super.begin() - 1;
+        k -= (size_t)_super[s];
+        const uint64_t* w = _bm->words();
+        for (size_t i = s * SUPER_WORDS;; ++i) {
+            size_t c = popcount64(w[i]);
+            if (k < c) return (i << 6) + selectInWord(w[i], (int)k);
+            k -= c;
+        }
+    }
+};
+
+} // namespace MySTL
+
+#endif
@@ -0,0 +1,506 @@
+#ifndef MYSTL_BTREE_H
+#define MYSTL_BTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace MySTL {
+
+/*====================================================
+    B+ ӳ
+    - ÿļֵԼ 4 У
+      ʱһ˳/ֱȽϣָת
+    - ֻҶҶ˫ӣû
+    - 롢ɾؼ¼µ·Եϵûеݹ
+    KV ĬϹ͸ֵ
+====================================================*/
+template<typename K, typename V, typename Compare = std::less<K> >
+class BTreeMap {
+private:
+    static const int NODE_BYTES = 256;
+    static const int LEAF_SLOTS = NODE_BYTES / (int)(sizeof(K) + sizeof(V)) > 8
+                                ? NODE_BYTES / (int)(sizeof(K) + sizeof(V)) : 8;
+    static const int INNER_SLOTS = NODE_BYTES / (int)(sizeof(K) + sizeof(void*)) > 8
+                                 ? NODE_BYTES / (int)(sizeof(K) + sizeof(void*)) : 8;
+    static const int LEAF_MIN = LEAF_SLOTS / 2;
+    static const int INNER_MIN = INNER_SLOTS / 2;
+    static const int MAX_DEPTH = 48;
+
+    struct Node {
+        bool leaf;
+        int count;      // ҶӣԪڲ㣺 = count + 1
+    };
+
+    struct Leaf : Node {
+        K keys[LEAF_SLOTS];
+        V vals[LEAF_SLOTS];
+        Leaf* prev;
+        Leaf* next;
+        Leaf() : prev(nullptr), next(nullptr) {
+            this->leaf = true;
+            this->count = 0;
+        }
+    };
+
+    struct Inner : Node {
+        K keys[INNER_SLOTS];
+        Node* child[INNER_SLOTS + 1];
+        Inner() {
+            this->leaf = false;
+            this->count = 0;
+        }
+    };
+
+    Node* _root;
+    Leaf* _head;        // Ҷ
+    size_t _size;
+    int _height;        // ڲ
+    Compare _less;
+
+    // ֹ
+    BTreeMap(const BTreeMap&);
+    BTreeMap& operator=(const BTreeMap&);
+
+    // һ > k λãڲѡã
+    int upperPos(const K* keys, int n, const K& k) const {
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = (lo + hi) >> 1;
+            if (_less(k, keys[mid])) hi = mid;
+            else lo = mid + 1;
+        }
+        return lo;
+    }
+
+    // һ >= k λ
+    int lowerPos(const K* keys, int n, const K& k) const {
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = (lo + hi) >> 1;
+            if (_less(keys[mid], k)) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    // ½Ҷӣ¼ڲѡ±
+    Leaf* descend(const K& k, Inner** path, int* idx) const {
+        Node* n = _root;
+        int d = 0;
+        while (!n->leaf) {
+            Inner* in = static_cast<Inner*>(n);
+            int i = upperPos(in->keys, in->count, k);
+            if (path) {
+                path[d] = in;
+                idx[d] = i;
+            }
+            d++;
+            n = in->child[i];
+        }
+        return static_cast<Leaf*>(n);
+    }
+
+    // ڲ in  pos  key Һ right˾ͷѣ
+    // ʱ½㲢ͨ up ļ
+    Inner* insertInner(Inner* in, int pos, const K& key, Node* right, K& up) {
+        if (in->count < INNER_SLOTS) {
+            for (int j = in->count; j > pos; --j) {
+                in->keys[j] = in->keys[j - 1];
+                in->child[j + 1] = in->child[j];
+            }
+            in->keys[pos] = key;
+            in->child[pos + 1] = right;
+            in->count++;
+            return nullptr;
+        }
+        // ׷ʱƽ֣˳ɱֽȫ
+        int mid = pos == INNER_SLOTS ? INNER_SLOTS - 1 : INNER_SLOTS / 2;
+        Inner* r = new Inner();
+        up = in->keys[mid];
+        r->count = INNER_SLOTS - mid - 1;
+        for (int j = 0; j < r->count; ++j) {
+            r->keys[j] = in->keys[mid + 1 + j];
+            r->child[j] = in->child[mid + 1 + j];
+        }
+        r->child[r->count] = in->child[INNER_SLOTS];
+        in->count = mid;
+        K unused;
+        if (pos <= mid) insertInner(in, pos, key, right, unused);
+        else insertInner(r, pos - mid - 1, key, right, unused);
+        return r;
+    }
+
+    void removeInnerAt(Inner* in, int keyPos) {
+        // ɾ keys[keyPos] Һ child[keyPos + 1]
+        for (int j = keyPos; j + 1 < in->count; ++j) {
+            in->keys[j] = in->keys[j + 1];
+            in->child[j + 1] = in->child[j + 2];
+        }
+        in->count--;
+    }
+
+    // Ҷ磺ֵֵܽܺϲ
+    void fixLeaf(Leaf* l, Inner* p, int i) {
+        Leaf* ls = i > 0 ? static_cast<Leaf*>(p->child[i - 1]) : nullptr;
+        Leaf* rs = i < p->count ? static_cast<Leaf*>(p->child[i + 1]) : nullptr;
+        if (ls && ls->count > LEAF_MIN) {
+            for (int j = l->count; j > 0; --j) {
+                l->keys[j] = l->keys[j - 1];
+                l->vals[j] = l->vals[j - 1];
+            }
+            l->keys[0] = ls->keys[ls->count - 1];
+            l->vals[0] = ls->vals[ls->count - 1];
+            ls->count--;
+            l->count++;
+            p->keys[i - 1] = l->keys[0];
+        } else if (rs && rs->count > LEAF_MIN) {
+            l->keys[l->count] = rs->keys[0];
+            l->vals[l->count] = rs->vals[0];
+            l->count++;
+            for (int j = 0; j + 1 < rs->count; ++j) {
+                rs->keys[j] = rs->keys[j + 1];
+                rs->vals[j] = rs->vals[j + 1];
+            }
+            rs->count--;
+            p->keys[i] = rs->keys[0];
+        } else if (ls) {
+            mergeLeaves(ls, l);
+            removeInnerAt(p, i - 1);
+        } else {
+            mergeLeaves(l, rs);
+            removeInnerAt(p, i);
+        }
+    }
+
+    //  b  aa 󣩣ͷ b
+    void mergeLeaves(Leaf* a, Leaf* b) {
+        for (int j = 0; j < b->count; ++j) {
+            a->keys[a->count + j] = b->keys[j];
+            a->vals[a->count + j] = b->vals[j];
+        }
+        a->count += b->count;
+        a->next = b->next;
+        if (b->next) b->next->prev = a;
+        delete b;
+    }
+
+    // ڲ磺תֵܺϲ
+    void fixInner(Inner* n, Inner* p, int i) {
+        Inner* ls = i > 0 ? static_cast<Inner*>(p->child[i - 1]) : nullptr;
+        Inner* rs = i < p->count ? static_cast<Inner*>(p->child[i + 1]) : nullptr;
+        if (ls && ls->count > INNER_MIN) {
+            n->child[n->count + 1] = n->child[n->count];
+            for (int j = n->count; j > 0; --j) {
+                n->keys[j] = n->keys[j - 1];
+                n->child[j] = n->child[j - 1];
+            }
+            n->keys[0] = p->keys[i - 1];
+            n->child[0] = ls->child[ls->count];
+            p->keys[i - 1] = ls->keys[ls->count - 1];
+            ls->count--;
+            n->count++;
+        } else if (rs && rs->count > INNER_MIN) {
+            n->keys[n->count] = p->keys[i];
+            n->child[n->count + 1] = rs->child[0];
+            n->count++;
+            p->keys[i] = rs->keys[0];
+            for (int j = 0; j + 1 < rs->count; ++j) {
+                rs->keys[j] = rs->keys[j + 1];
+                rs->child[j] = rs->child[j + 1];
+            }
+            rs->child[rs->count - 1] = rs->child[rs->count];
+            rs->count--;
+        } else if (ls) {
+            mergeInner(ls, n, p->keys[i - 1]);
+            removeInnerAt(p, i - 1);
+        } else {
+            mergeInner(n, rs, p->keys[i]);
+            removeInnerAt(p, i);
+        }
+    }
+
+    void mergeInner(Inner* a, Inner* b, const K& sep) {
+        a->keys[a->count] = sep;
+        for (int j = 0; j < b->count; ++j) a->keys[a->count + 1 + j] = b->keys[j];
+        for (int j = 0; j <= b->count; ++j) a->child[a->count + 1 + j] = b->child[j];
+        a->count += 1 + b->count;
+        delete b;
+    }
+
+    void destroy(Node* n) {
+        if (!n->leaf) {
+            Inner* in = static_cast<Inner*>(n);
+            for (int j = 0; j <= in->count; ++j) destroy(in->child[j]);
+            delete in;
+        } else {
+            delete static_cast<Leaf*>(n);
+        }
+    }
+
+public:
+    class iterator {
+    private:
+        Leaf* _leaf;
+        int _pos;
+        friend class BTreeMap;
+    public:
+        iterator(Leaf* l = nullptr, int p = 0) : _leaf(l), _pos(p) {}
+
+        const K& key() const { return _leaf->keys[_pos]; }
+        V& value() const { return _leaf->vals[_pos]; }
+
+        iterator& operator++() {
+            if (++_pos >= _leaf->count) {
+                _leaf = _leaf->next;
+                _pos = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const iterator& o) const { return _leaf == o._leaf && _pos == o._pos; }
+        bool operator!=(const iterator& o) const { return !(*this == o); }
+    };
+
+    BTreeMap() : _size(0), _height(0) {
+        _head = new Leaf();
+        _root = _head;
+    }
+
+    ~BTreeMap() {
+        destroy(_root);
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    bool empty() const {
+        return _size == 0;
+    }
+
+    int height() const {
+        return _height + 1;
+    }
+
+    void clear() {
+        destroy(_root);
+        _head = new Leaf();
+        _root = _head;
+        _size = 0;
+        _height = 0;
+    }
+
+    iterator begin() const {
+        return _head->count ? iterator(_head, 0) : end();
+    }
+
+    iterator end() const {
+        return iterator(nullptr, 0);
+    }
+
+    iterator find(const K& k) const {
+        Leaf* l = descend(k, nullptr, nullptr);
+        int i = lowerPos(l->keys, l->count, k);
+        if (i < l->count && !_less(k, l->keys[i])) return iterator(l, i);
+        return end();
+    }
+
+    bool contains(const K& k) const {
+        return find(k) != end();
+    }
+
+    // һ >= k Ԫ
+    iterator lowerBound(const K& k) const {
+        Leaf* l = descend(k, nullptr, nullptr);
+        int i = lowerPos(l->keys, l->count, k);
+        if (i < l->count) return iterator(l, i);
+        return l->next ? iterator(l->next, 0) : end();
+    }
+
+    //  [lo, hi) ڵԪε visit(key, value)
+    template<typename VST>
+    void forRange(const K& lo, const K& hi, VST visit) const {
+        for (iterator it = lowerBound(lo); it != end() && _less(it.key(), hi); ++it)
+            visit(it.key(), it.value());
+    }
+
+    // 룻Ѵʱǣ false
+    bool insert(const K& k, const V& v) {
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        Leaf* l = descend(k, path, idx);
+        int pos = lowerPos(l->keys, l->count, k);
+        if (pos < l->count && !_less(k, l->keys[pos])) return false;
+        _size++;
+
+        if (l->count < LEAF_SLOTS) {
+            for (int j = l->count; j > pos; --j) {
+                l->keys[j] = l->keys[j - 1];
+                l->vals[j] = l->vals[j - 1];
+            }
+            l->keys[pos] = k;
+            l->vals[pos] = v;
+            l->count++;
+            return true;
+        }
+
+        // Ҷӷѣ׷ʱҶȫ
+        int mid = (pos == LEAF_SLOTS && l->next == nullptr) ? LEAF_SLOTS : LEAF_SLOTS / 2;
+        Leaf* r = new Leaf();
+        r->count = LEAF_SLOTS - mid;
+        for (int j = 0; j < r->count; ++j) {
+            r->keys[j] = l->keys[mid + j];
+            r->vals[j] = l->vals[mid + j];
+        }
+        l->count = mid;
+        Leaf* target = pos < mid ? l : r;
+        int tp = pos < mid ? pos : pos - mid;
+        for (int j = target->count; j > tp; --j) {
+            target->keys[j] = target->keys[j - 1];
+            target->vals[j] = target->vals[j - 1];
+        }
+        target->keys[tp] = k;
+        target->vals[tp] = v;
+        target->count++;
+        r->next = l->next;
+        r->prev = l;
+        if (l->next) l->next->prev = r;
+        l->next = r;
+
+        // ָϲ
+        K sep = r->keys[0];
+        Node* right = r;
+        for (int d = _height - 1; d >= 0; --d) {
+            K up;
+            Inner* split = insertInner(path[d], idx[d], sep, right, up);
+            if (!split) return true;
+            sep = up;
+            right = split;
+        }
+        if (_height + 1 >= MAX_DEPTH) throw std::length_error("BTreeMap: too deep");
+        Inner* nr = new Inner();
+        nr->count = 1;
+        nr->keys[0] = sep;
+        nr->child[0] = _root;
+        nr->child[1] = right;
+        _root = nr;
+        _height++;
+        return true;
+    }
+
+    // ɾڷ false
+    bool erase(const K& k) {
+        Inner* path[MAX_DEPTH];
+        int idx[MAX_DEPTH];
+        Leaf* l = descend(k, path, idx);
+        int pos = lowerPos(l->keys, l->count, k);
+        if (pos >= l->count || _less(k, l->keys[pos])) return false;
+        for (int j = pos; j + 1 < l->count; ++j) {
+            l->keys[j] = l->keys[j + 1];
+            l->vals[j] = l->vals[j + 1];
+        }
+        l->count--;
+        _size--;
+
+        if (_height == 0 || l->count >= LEAF_MIN) return true;
+        fixLeaf(l, path[_height - 1], idx[_height - 1]);
+        for (int d = _height - 1; d > 0; --d) {
+            if (path[d]->count >= INNER_MIN) return true;
+            fixInner(path[d], path[d - 1], idx[d - 1]);
+        }
+        // ֻʣһʱһ
+        Inner* r = static_cast<Inner*>(_root);
+        if (r->count == 0) {
+            _root = r->child[0];
+            delete r;
+            _height--;
+        }
+        if (_root->leaf) _head = static_cast<Leaf*>(_root);
+        return true;
+    }
+
+    /*------------------------------------------------
+        ظ (, ֵ) 
+        ҶԵϽڲ
+    ------------------------------------------------*/
+    void bulkLoad(const std::vector<std::pair<K, V> >& items) {
+        for (size_t i = 1; i < items.size(); ++i)
+            if (!_less(items[i - 1].first, items[i].first))
+                throw std::invalid_argument("BTreeMap::bulkLoad: input not strictly sorted");
+        clear();
+        if (items.empty()) return;
+
+        std::vector<Node*> level;
+        std::vector<K> lowKey;     // ÿеС
+        Leaf* prev = nullptr;
+        for (size_t i = 0; i < items.size(); i += LEAF_SLOTS) {
+            Leaf* l = (i == 0) ? _head : new Leaf();
+            size_t n = std::min(items.size() - i, (size_t)LEAF_SLOTS);
+            for (size_t j = 0; j < n; ++j) {
+                l->keys[j] = items[i + j].first;
+                l->vals[j] = items[i + j].second;
+            }
+            l->count = (int)n;
+            l->prev = prev;
+            if (prev) prev->next = l;
+            prev = l;
+            level.push_back(l);
+            lowKey.push_back(l->keys[0]);
+        }
+        // һҶӲʱǰһƽ
+        if (level.size() > 1 && prev->count < LEAF_MIN) {
+            Leaf* a = static_cast<Leaf*>(level[level.size() - 2]);
+            int total = a->count + prev->count;
+            int move = total / 2 - prev->count;
+            for (int j = prev->count - 1; j >= 0; --j) {
+                prev->keys[j + move] = prev->keys[j];
+                prev->vals[j + move] = prev->vals[j];
+            }
+            for (int j = 0; j < move; ++j) {
+                prev->keys[j] = a->keys[a->count - move + j];
+                prev->vals[j] = a->vals[a->count - move + j];
+            }
+            a->count -= move;
+            prev->count += move;
+            lowKey.back() = prev->keys[0];
+        }
+        _size = items.size();
+
+        while (level.size() > 1) {
+            std::vector<Node*> up;
+            std::vector<K> upKey;
+            size_t per = INNER_SLOTS + 1;
+            for (size_t i = 0; i < level.size(); i += per) {
+                size_t n = std::min(level.size() - i, per);
+                // ĩβֻʣһʱǰһȹ
+                if (n < (size_t)INNER_MIN + 1 && !up.empty()) {
+                    Inner* a = static_cast<Inner*>(up.back());
+                    size_t back = (size_t)INNER_MIN + 1 - n;
+                    a->count -= (int)back;
+                    i -= back;
+                    n += back;
+                }
+                Inner* in = new Inner();
+                in->count = (int)n - 1;
+                for (size_t j = 0; j < n; ++j) {
+                    in->child[j] = level[i + j];
+                    if (j > 0) in->keys[j - 1] = lowKey[i + j];
+                }
+                up.push_back(in);
+                upKey.push_back(lowKey[i]);
+            }
+            level.swap(up);
+            lowKey.swap(upKey);
+            _height++;
+        }
+        _root = level[0];
+    }
+};
+
+} // namespace MySTL
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef MYSTL_MAPPED_FILE_H
+#define MYSTL_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MySTL {
+
+// ֻڴӳļļ벻ڴ棩
+class MappedFile {
+private:
+    const unsigned char* _data;   // ӳ׵ַ
+    size_t _size;                 // ļֽ
+#ifdef _WIN32
+    HANDLE _file;
+    HANDLE _map;
+#else
+    int _fd;
+#endif
+
+    // ֹ
+    MappedFile(const MappedFile&);
+    MappedFile& operator=(const MappedFile&);
+
+public:
+#ifdef _WIN32
+    MappedFile() : _data(nullptr), _size(0), _file(INVALID_HANDLE_VALUE), _map(nullptr) {}
+#else
+    MappedFile() : _data(nullptr), _size(0), _fd(-1) {}
+#endif
+
+    ~MappedFile() {
+        close();
+    }
+
+    // 򿪲ӳļʧܷ falsesequential Ϊʱʾ˳ʵݣ
+    bool open(const std::string& path, bool sequential = true) {
+        close();
+#ifdef _WIN32
+        _file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (_file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER sz;
+        if (!GetFileSizeEx(_file, &sz)) { close(); return false; }
+        _size = (size_t)sz.QuadPart;
+        if (_size == 0) return true;  // ļӳ
+        _map = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_map == nullptr) { close(); return false; }
+        _data = (const unsigned char*)MapViewOfFile(_map, FILE_MAP_READ, 0, 0, 0);
+        if (_data == nullptr) { close(); return false; }
+#else
+        _fd = ::open(path.c_str(), O_RDONLY);
+        if (_fd < 0) return false;
+        struct stat st;
+        if (fstat(_fd, &st) != 0) { close(); return false; }
+        _size = (size_t)st.st_size;
+        if (_size == 0) return true;  // ļӳ
+        void* p = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+        if (p == MAP_FAILED) { close(); return false; }
+        _data = (const unsigned char*)p;
+        if (sequential) madvise(p, _size, MADV_SEQUENTIAL);
+#endif
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (_data) UnmapViewOfFile(_data);
+        if (_map) CloseHandle(_map);
+        if (_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+        _map = nullptr;
+        _file = INVALID_HANDLE_VALUE;
+#else
+        if (_data) munmap((void*)_data, _size);
+        if (_fd >= 0) ::close(_fd);
+        _fd = -1;
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+    const unsigned char* data() const {
+        return _data;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+};
+
+} // namespace MySTL
+
+#endif
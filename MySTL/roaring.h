@@ -0,0 +1,731 @@
+#ifndef MYSTL_ROARING_H
+#define MYSTL_ROARING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "bitmap.h"
+
+namespace MySTL {
+
+/*====================================================
+    ѹλͼRoaring ṹ
+    32 λ 16 λֳ 64K 飬ÿ鰴ܶѡ
+      ARRAY  :  uint16 飬Ԫز 4096 
+      BITSET : 65536 λĶλͼ8KB
+      RUN    :  [start, start + length]
+    ֻǿտ飬򣬱ڰ鲢/
+====================================================*/
+class RoaringBitmap {
+public:
+    enum ContainerType {
+        ARRAY = 0,
+        BITSET = 1,
+        RUN = 2
+    };
+
+    static const uint32_t ARRAY_MAX = 4096;
+    static const uint32_t CHUNK_BITS = 65536;
+
+    struct Run {
+        uint16_t start;
+        uint16_t length;    //  length + 1 
+    };
+
+    struct Container {
+        uint8_t type;
+        uint32_t card;                  // Ԫظ
+        std::vector<uint16_t> array;
+        Bitmap bits;
+        std::vector<Run> runs;
+
+        Container() : type(ARRAY), card(0) {}
+    };
+
+private:
+    std::vector<uint16_t> _keys;        // ţ 16 λ
+    std::vector<Container> _cont;
+
+    /*------------------------------------------------
+        ֮ת
+    ------------------------------------------------*/
+    static Run makeRun(uint32_t start, uint32_t last) {
+        Run r;
+        r.start = (uint16_t)start;
+        r.length = (uint16_t)(last - start);
+        return r;
+    }
+
+    static void bitsetFromArray(Container& c) {
+        c.bits = Bitmap(CHUNK_BITS);
+        for (size_t i = 0; i < c.array.size(); ++i) c.bits.set(c.array[i]);
+        std::vector<uint16_t>().swap(c.array);
+        c.type = BITSET;
+    }
+
+    static void bitsetFromRuns(Container& c) {
+        c.bits = Bitmap(CHUNK_BITS);
+        for (size_t i = 0; i < c.runs.size(); ++i)
+            c.bits.setRange(c.runs[i].start, (size_t)c.runs[i].start + c.runs[i].length + 1);
+        std::vector<Run>().swap(c.runs);
+        c.type = BITSET;
+    }
+
+    static void arrayFromBitset(Container& c) {
+        c.array.clear();
+        c.array.reserve(c.card);
+        c.bits.forEach([&](size_t k) { c.array.push_back((uint16_t)k); });
+        c.bits = Bitmap();
+        c.type = ARRAY;
+    }
+
+    static void arrayFromRuns(Container& c) {
+        c.array.clear();
+        c.array.reserve(c.card);
+        for (size_t i = 0; i < c.runs.size(); ++i) {
+            uint32_t s = c.runs[i].start, e = s + c.runs[i].length;
+            for (uint32_t v = s; v <= e; ++v) c.array.push_back((uint16_t)v);
+        }
+        std::vector<Run>().swap(c.runs);
+        c.type = ARRAY;
+    }
+
+    static void runsFromArray(Container& c) {
+        c.runs.clear();
+        for (size_t i = 0; i < c.array.size();) {
+            size_t j = i;
+            while (j + 1 < c.array.size() && c.array[j + 1] == c.array[j] + 1) j++;
+            c.runs.push_back(makeRun(c.array[i], c.array[j]));
+            i = j + 1;
+        }
+        std::vector<uint16_t>().swap(c.array);
+        c.type = RUN;
+    }
+
+    static void runsFromBitset(Container& c) {
+        c.runs.clear();
+        const uint64_t* w = c.bits.words();
+        const size_t nw = CHUNK_BITS / 64;
+        size_t s = c.bits.findNext(0);
+        while (s != Bitmap::npos) {
+            //  s ֮һ 0
+            size_t wi = s >> 6;
+            uint64_t x = ~w[wi] & (~0ULL << (s & 63));
+            while (x == 0 && ++wi < nw) x = ~w[wi];
+            size_t e = wi < nw ? (wi << 6) + ctz64(x) : CHUNK_BITS;
+            c.runs.push_back(makeRun((uint32_t)s, (uint32_t)e - 1));
+            s = e < CHUNK_BITS ? c.bits.findNext(e) : Bitmap::npos;
+        }
+        c.bits = Bitmap();
+        c.type = RUN;
+    }
+
+    // λͼе = ǰһλΪ 0 λ
+    static uint32_t countRuns(const Bitmap& b) {
+        const uint64_t* w = b.words();
+        uint64_t carry = 0;
+        uint32_t n = 0;
+        for (size_t i = 0; i < CHUNK_BITS / 64; ++i) {
+            n += popcount64(w[i] & ~((w[i] << 1) | carry));
+            carry = w[i] >> 63;
+        }
+        return n;
+    }
+
+    static uint32_t countRuns(const std::vector<uint16_t>& a) {
+        uint32_t n = a.empty() ? 0 : 1;
+        for (size_t i = 1; i < a.size(); ++i) n += a[i] != a[i - 1] + 1;
+        return n;
+    }
+
+    // ֻ ARRAY / BITSET лRUN ֲ
+    static void repair(Container& c) {
+        if (c.type == ARRAY && c.card > ARRAY_MAX) bitsetFromArray(c);
+        else if (c.type == BITSET && c.card <= ARRAY_MAX) arrayFromBitset(c);
+    }
+
+    // ѡֱʾռСһ
+    static void chooseBest(Container& c) {
+        size_t runBytes, arrayBytes = c.card <= ARRAY_MAX ? 2 * (size_t)c.card : (size_t)-1;
+        const size_t bitsetBytes = CHUNK_BITS / 8;
+        if (c.type == RUN) runBytes = 4 * c.runs.size() + 2;
+        else if (c.type == ARRAY) runBytes = 4 * (size_t)countRuns(c.array) + 2;
+        else runBytes = 4 * (size_t)countRuns(c.bits) + 2;
+
+        if (runBytes < arrayBytes && runBytes < bitsetBytes) {
+            if (c.type == ARRAY) runsFromArray(c);
+            else if (c.type == BITSET) runsFromBitset(c);
+        } else if (arrayBytes <= bitsetBytes) {
+            if (c.type == RUN) arrayFromRuns(c);
+            else if (c.type == BITSET) arrayFromBitset(c);
+        } else {
+            if (c.type == RUN) bitsetFromRuns(c);
+            else if (c.type == ARRAY) bitsetFromArray(c);
+        }
+    }
+
+    // һ start <= v ±꣬û -1
+    static long findRun(const std::vector<Run>& runs, uint16_t v) {
+        size_t lo = 0, hi = runs.size();
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (runs[mid].start <= v) lo = mid + 1;
+            else hi = mid;
+        }
+        return (long)lo - 1;
+    }
+
+    /*------------------------------------------------
+        
+    ------------------------------------------------*/
+    static bool containerContains(const Container& c, uint16_t v) {
+        if (c.type == ARRAY) return std::binary_search(c.array.begin(), c.array.end(), v);
+        if (c.type == BITSET) return c.bits.test(v);
+        long i = findRun(c.runs, v);
+        return i >= 0 && v <= (uint32_t)c.runs[i].start + c.runs[i].length;
+    }
+
+    static bool containerAdd(Container& c, uint16_t v) {
+        if (c.type == ARRAY) {
+            std::vector<uint16_t>::iterator it = std::lower_bound(c.array.begin(), c.array.end(), v);
+            if (it != c.array.end() && *it == v) return false;
+            if (c.card < ARRAY_MAX) {
+                c.array.insert(it, v);
+                c.card++;
+                return true;
+            }
+            bitsetFromArray(c);
+        }
+        if (c.type == BITSET) {
+            if (c.bits.test(v)) return false;
+            c.bits.set(v);
+            c.card++;
+            return true;
+        }
+        // RUNӳ
+        long i = findRun(c.runs, v);
+        if (i >= 0 && v <= (uint32_t)c.runs[i].start + c.runs[i].length) return false;
+        bool joinPrev = i >= 0 && (uint32_t)c.runs[i].start + c.runs[i].length + 1 == v;
+        bool joinNext = (size_t)(i + 1) < c.runs.size() && (uint32_t)v + 1 == c.runs[i + 1].start;
+        if (joinPrev && joinNext) {
+            c.runs[i].length = (uint16_t)(c.runs[i].length + c.runs[i + 1].length + 2);
+            c.runs.erase(c.runs.begin() + i + 1);
+        } else if (joinPrev) {
+            c.runs[i].length++;
+        } else if (joinNext) {
+            c.runs[i + 1].start--;
+            c.runs[i + 1].length++;
+        } else {
+            c.runs.insert(c.runs.begin() + (i + 1), makeRun(v, v));
+        }
+        c.card++;
+        return true;
+    }
+
+    static bool containerRemove(Container& c, uint16_t v) {
+        if (c.type == ARRAY) {
+            std::vector<uint16_t>::iterator it = std::lower_bound(c.array.begin(), c.array.end(), v);
+            if (it == c.array.end() || *it != v) return false;
+            c.array.erase(it);
+            c.card--;
+            return true;
+        }
+        if (c.type == BITSET) {
+            if (!c.bits.test(v)) return false;
+            c.bits.clear(v);
+            c.card--;
+            repair(c);
+            return true;
+        }
+        long i = findRun(c.runs, v);
+        if (i < 0) return false;
+        uint32_t s = c.runs[i].start, e = s + c.runs[i].length;
+        if (v > e) return false;
+        if (s == e) {
+            c.runs.erase(c.runs.begin() + i);
+        } else if (v == s) {
+            c.runs[i] = makeRun(s + 1, e);
+        } else if (v == e) {
+            c.runs[i] = makeRun(s, e - 1);
+        } else {
+            c.runs[i] = makeRun(s, v - 1);
+            c.runs.insert(c.runs.begin() + (i + 1), makeRun(v + 1, e));
+        }
+        c.card--;
+        return true;
+    }
+
+    // ݲλͼ
+    static void orInto(Bitmap& bits, const Container& c) {
+        if (c.type == BITSET) {
+            bits |= c.bits;
+        } else if (c.type == ARRAY) {
+            for (size_t i = 0; i < c.array.size(); ++i) bits.set(c.array[i]);
+        } else {
+            for (size_t i = 0; i < c.runs.size(); ++i)
+                bits.setRange(c.runs[i].start, (size_t)c.runs[i].start + c.runs[i].length + 1);
+        }
+    }
+
+    static uint32_t runsCard(const std::vector<Run>& runs) {
+        uint32_t n = 0;
+        for (size_t i = 0; i < runs.size(); ++i) n += runs[i].length + 1u;
+        return n;
+    }
+
+    // 鲢صڵĺϳһ
+    static void mergeRuns(const std::vector<Run>& a, const std::vector<Run>& b, std::vector<Run>& out) {
+        out.clear();
+        size_t i = 0, j = 0;
+        while (i < a.size() || j < b.size()) {
+            const Run& r = (j >= b.size() || (i < a.size() && a[i].start <= b[j].start)) ? a[i++] : b[j++];
+            uint32_t s = r.start, e = s + r.length;
+            if (!out.empty() && s <= (uint32_t)out.back().start + out.back().length + 1) {
+                uint32_t os = out.back().start, oe = os + out.back().length;
+                out.back() = makeRun(os, std::max(oe, e));
+            } else {
+                out.push_back(makeRun(s, e));
+            }
+        }
+    }
+
+    static Container unionOf(const Container& a, const Container& b) {
+        Container r;
+        if (a.type == BITSET || b.type == BITSET) {
+            const Container& big = a.type == BITSET ? a : b;
+            const Container& other = a.type == BITSET ? b : a;
+            r.type = BITSET;
+            r.bits = big.bits;
+            orInto(r.bits, other);
+            r.card = (uint32_t)r.bits.count();
+            return r;
+        }
+        if (a.type == ARRAY && b.type == ARRAY) {
+            r.array.resize(a.array.size() + b.array.size());
+            r.array.resize(std::set_union(a.array.begin(), a.array.end(), b.array.begin(), b.array.end(),
+                                          r.array.begin()) - r.array.begin());
+            r.card = (uint32_t)r.array.size();
+            repair(r);
+            return r;
+        }
+        // һ RUNٹ鲢
+        Container ta, tb;
+        const std::vector<Run>* ra = &a.runs;
+        const std::vector<Run>* rb = &b.runs;
+        if (a.type == ARRAY) { ta = a; runsFromArray(ta); ra = &ta.runs; }
+        if (b.type == ARRAY) { tb = b; runsFromArray(tb); rb = &tb.runs; }
+        r.type = RUN;
+        mergeRuns(*ra, *rb, r.runs);
+        r.card = runsCard(r.runs);
+        chooseBest(r);
+        return r;
+    }
+
+    // 󽻣СʱԴ + 
+    static void intersectArrays(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b,
+                                std::vector<uint16_t>& out) {
+        out.clear();
+        const std::vector<uint16_t>& s = a.size() <= b.size() ? a : b;
+        const std::vector<uint16_t>& l = a.size() <= b.size() ? b : a;
+        if (s.size() * 32 < l.size()) {
+            size_t pos = 0;
+            for (size_t i = 0; i < s.size() && pos < l.size(); ++i) {
+                size_t step = 1, hi = pos;
+                while (hi < l.size() && l[hi] < s[i]) {
+                    pos = hi;
+                    hi += step;
+                    step *= 2;
+                }
+                pos = std::lower_bound(l.begin() + pos, l.begin() + std::min(hi + 1, l.size()), s[i]) - l.begin();
+                if (pos < l.size() && l[pos] == s[i]) out.push_back(s[i]);
+            }
+            return;
+        }
+        out.resize(s.size());
+        out.resize(std::set_intersection(s.begin(), s.end(), l.begin(), l.end(), out.begin()) - out.begin());
+    }
+
+    static Container intersectionOf(const Container& a, const Container& b) {
+        Container r;
+        if (a.type == ARRAY && b.type == ARRAY) {
+            intersectArrays(a.array, b.array, r.array);
+        } else if (a.type == ARRAY || b.type == ARRAY) {
+            // жԱ
+            const Container& arr = a.type == ARRAY ? a : b;
+            const Container& other = a.type == ARRAY ? b : a;
+            if (other.type == BITSET) {
+                for (size_t i = 0; i < arr.array.size(); ++i)
+                    if (other.bits.test(arr.array[i])) r.array.push_back(arr.array[i]);
+            } else {
+                size_t j = 0;
+                for (size_t i = 0; i < arr.array.size() && j < other.runs.size(); ++i) {
+                    uint16_t v = arr.array[i];
+                    while (j < other.runs.size() && (uint32_t)other.runs[j].start + other.runs[j].length < v) j++;
+                    if (j < other.runs.size() && other.runs[j].start <= v) r.array.push_back(v);
+                }
+            }
+        } else if (a.type == RUN && b.type == RUN) {
+            r.type = RUN;
+            size_t i = 0, j = 0;
+            while (i < a.runs.size() && j < b.runs.size()) {
+                uint32_t ae = (uint32_t)a.runs[i].start + a.runs[i].length;
+                uint32_t be = (uint32_t)b.runs[j].start + b.runs[j].length;
+                uint32_t s = std::max(a.runs[i].start, b.runs[j].start);
+                uint32_t e = std::min(ae, be);
+                if (s <= e) r.runs.push_back(makeRun(s, e));
+                if (ae < be) i++;
+                else j++;
+            }
+            r.card = runsCard(r.runs);
+            chooseBest(r);
+            return r;
+        } else {
+            // BITSET  BITSET / RUN
+            r.type = BITSET;
+            r.bits = a.type == BITSET ? a.bits : b.bits;
+            const Container& other = a.type == BITSET ? b : a;
+            if (other.type == BITSET) {
+                r.bits &= other.bits;
+            } else {
+                Bitmap mask(CHUNK_BITS);
+                orInto(mask, other);
+                r.bits &= mask;
+            }
+            r.card = (uint32_t)r.bits.count();
+            repair(r);
+            return r;
+        }
+        r.card = (uint32_t)r.array.size();
+        return r;
+    }
+
+    size_t findKey(uint16_t key) const {
+        return std::lower_bound(_keys.begin(), _keys.end(), key) - _keys.begin();
+    }
+
+    static void putU32(std::vector<unsigned char>& out, uint32_t v) {
+        for (int i = 0; i < 4; ++i) out.push_back((unsigned char)(v >> (8 * i)));
+    }
+
+    static void putU16(std::vector<unsigned char>& out, uint16_t v) {
+        out.push_back((unsigned char)v);
+        out.push_back((unsigned char)(v >> 8));
+    }
+
+public:
+    RoaringBitmap() {}
+
+    //  xǷ¼
+    bool add(uint32_t x) {
+        uint16_t key = (uint16_t)(x >> 16);
+        size_t i = findKey(key);
+        if (i == _keys.size() || _keys[i] != key) {
+            _keys.insert(_keys.begin() + i, key);
+            _cont.insert(_cont.begin() + i, Container());
+        }
+        return containerAdd(_cont[i], (uint16_t)x);
+    }
+
+    // 룺Ȱ 16 λͰ齨 add Ĳƶ
+    void addMany(const uint32_t* vals, size_t n) {
+        std::vector<size_t> start(CHUNK_BITS + 1, 0);
+        for (size_t i = 0; i < n; ++i) start[(vals[i] >> 16) + 1]++;
+        for (size_t k = 0; k < CHUNK_BITS; ++k) start[k + 1] += start[k];
+        std::vector<size_t> fill(start.begin(), start.end() - 1);
+        std::vector<uint16_t> low(n);
+        for (size_t i = 0; i < n; ++i) low[fill[vals[i] >> 16]++] = (uint16_t)vals[i];
+
+        RoaringBitmap r;
+        for (size_t key = 0; key < CHUNK_BITS; ++key) {
+            size_t b = start[key], e = start[key + 1];
+            if (b == e) continue;
+            Container c;
+            if (e - b > ARRAY_MAX) {
+                c.type = BITSET;
+                c.bits = Bitmap(CHUNK_BITS);
+                for (size_t k = b; k < e; ++k) c.bits.set(low[k]);
+                c.card = (uint32_t)c.bits.count();
+                repair(c);
+            } else {
+                std::sort(low.begin() + b, low.begin() + e);
+                c.array.assign(low.begin() + b, std::unique(low.begin() + b, low.begin() + e));
+                c.card = (uint32_t)c.array.size();
+            }
+            r._keys.push_back((uint16_t)key);
+            r._cont.push_back(c);
+        }
+        if (empty()) {
+            _keys.swap(r._keys);
+            _cont.swap(r._cont);
+        } else {
+            *this |= r;
+        }
+    }
+
+    //  [lo, hi) 鸲ʱֱ
+    void addRange(uint64_t lo, uint64_t hi) {
+        if (hi > ((uint64_t)1 << 32)) hi = (uint64_t)1 << 32;
+        while (lo < hi) {
+            uint16_t key = (uint16_t)(lo >> 16);
+            uint32_t s = (uint32_t)(lo & 0xFFFF);
+            uint32_t e = (uint32_t)std::min<uint64_t>(hi - ((uint64_t)key << 16), CHUNK_BITS);
+            Container piece;
+            piece.type = RUN;
+            piece.runs.push_back(makeRun(s, e - 1));
+            piece.card = e - s;
+
+            size_t i = findKey(key);
+            if (i == _keys.size() || _keys[i] != key) {
+                _keys.insert(_keys.begin() + i, key);
+                _cont.insert(_cont.begin() + i, piece);
+            } else {
+                _cont[i] = unionOf(_cont[i], piece);
+            }
+            lo = ((uint64_t)key + 1) << 16;
+        }
+    }
+
+    bool remove(uint32_t x) {
+        uint16_t key = (uint16_t)(x >> 16);
+        size_t i = findKey(key);
+        if (i == _keys.size() || _keys[i] != key) return false;
+        bool removed = containerRemove(_cont[i], (uint16_t)x);
+        if (_cont[i].card == 0) {
+            _keys.erase(_keys.begin() + i);
+            _cont.erase(_cont.begin() + i);
+        }
+        return removed;
+    }
+
+    bool contains(uint32_t x) const {
+        uint16_t key = (uint16_t)(x >> 16);
+        size_t i = findKey(key);
+        return i < _keys.size() && _keys[i] == key && containerContains(_cont[i], (uint16_t)x);
+    }
+
+    uint64_t cardinality() const {
+        uint64_t n = 0;
+        for (size_t i = 0; i < _cont.size(); ++i) n += _cont[i].card;
+        return n;
+    }
+
+    bool empty() const {
+        return _keys.empty();
+    }
+
+    void clear() {
+        _keys.clear();
+        _cont.clear();
+    }
+
+    // ÿռСıʾã
+    void runOptimize() {
+        for (size_t i = 0; i < _cont.size(); ++i) chooseBest(_cont[i]);
+    }
+
+    // ÿԪص visit(x)
+    template<typename VST>
+    void forEach(VST visit) const {
+        for (size_t i = 0; i < _cont.size(); ++i) {
+            uint32_t high = (uint32_t)_keys[i] << 16;
+            const Container& c = _cont[i];
+            if (c.type == ARRAY) {
+                for (size_t k = 0; k < c.array.size(); ++k) visit(high | c.array[k]);
+            } else if (c.type == BITSET) {
+                c.bits.forEach([&](size_t k) { visit(high | (uint32_t)k); });
+            } else {
+                for (size_t k = 0; k < c.runs.size(); ++k) {
+                    uint32_t s = c.runs[k].start, e = s + c.runs[k].length;
+                    for (uint32_t v = s; v <= e; ++v) visit(high | v);
+                }
+            }
+        }
+    }
+
+    // 鲢󲢼
+    RoaringBitmap operator|(const RoaringBitmap& o) const {
+        RoaringBitmap r;
+        size_t i = 0, j = 0;
+        while (i < _keys.size() || j < o._keys.size()) {
+            if (j >= o._keys.size() || (i < _keys.size() && _keys[i] < o._keys[j])) {
+                r._keys.push_back(_keys[i]);
+                r._cont.push_back(_cont[i++]);
+            } else if (i >= _keys.size() || o._keys[j] < _keys[i]) {
+                r._keys.push_back(o._keys[j]);
+                r._cont.push_back(o._cont[j++]);
+            } else {
+                r._keys.push_back(_keys[i]);
+                r._cont.push_back(unionOf(_cont[i++], o._cont[j++]));
+            }
+        }
+        return r;
+    }
+
+    // ֻ߶еĿſཻ
+    RoaringBitmap operator&(const RoaringBitmap& o) const {
+        RoaringBitmap r;
+        size_t i = 0, j = 0;
+        while (i < _keys.size() && j < o._keys.size()) {
+            if (_keys[i] < o._keys[j]) {
+                i++;
+            } else if (o._keys[j] < _keys[i]) {
+                j++;
+            } else {
+                Container c = intersectionOf(_cont[i], o._cont[j]);
+                if (c.card > 0) {
+                    r._keys.push_back(_keys[i]);
+                    r._cont.push_back(c);
+                }
+                i++;
+                j++;
+            }
+        }
+        return r;
+    }
+
+    RoaringBitmap& operator|=(const RoaringBitmap& o) {
+        RoaringBitmap r = *this | o;
+        _keys.swap(r._keys);
+        _cont.swap(r._cont);
+        return *this;
+    }
+
+    RoaringBitmap& operator&=(const RoaringBitmap& o) {
+        RoaringBitmap r = *this & o;
+        _keys.swap(r._keys);
+        _cont.swap(r._cont);
+        return *this;
+    }
+
+    bool operator==(const RoaringBitmap& o) const {
+        if (_keys != o._keys) return false;
+        for (size_t i = 0; i < _cont.size(); ++i) {
+            if (_cont[i].card != o._cont[i].card) return false;
+            Container x = intersectionOf(_cont[i], o._cont[i]);
+            if (x.card != _cont[i].card) return false;
+        }
+        return true;
+    }
+
+    // ռõĶڴ棨ֽڣ
+    size_t memoryBytes() const {
+        size_t n = sizeof(*this) + _keys.capacity() * sizeof(uint16_t) + _cont.capacity() * sizeof(Container);
+        for (size_t i = 0; i < _cont.size(); ++i) {
+            const Container& c = _cont[i];
+            n += c.array.capacity() * sizeof(uint16_t) + c.runs.capacity() * sizeof(Run)
+               + c.bits.wordCount() * sizeof(uint64_t);
+        }
+        return n;
+    }
+
+    size_t containerCount(int type) const {
+        size_t n = 0;
+        for (size_t i = 0; i < _cont.size(); ++i) n += _cont[i].type == type;
+        return n;
+    }
+
+    /*------------------------------------------------
+        лСˣ
+          "RBM1" |  u32 | ÿ飺 u16  u8  u32 | 
+          ݣARRAY Ϊ card  u16BITSET Ϊ 1024  u64
+                RUN Ϊ u16 + (start u16, length u16) ...
+    ------------------------------------------------*/
+    void serialize(std::vector<unsigned char>& out) const {
+        out.clear();
+        const char magic[] = "RBM1";
+        for (int i = 0; i < 4; ++i) out.push_back((unsigned char)magic[i]);
+        putU32(out, (uint32_t)_keys.size());
+        for (size_t i = 0; i < _cont.size(); ++i) {
+            const Container& c = _cont[i];
+            putU16(out, _keys[i]);
+            out.push_back(c.type);
+            putU32(out, c.card);
+            if (c.type == ARRAY) {
+                for (size_t k = 0; k < c.array.size(); ++k) putU16(out, c.array[k]);
+            } else if (c.type == BITSET) {
+                const uint64_t* w = c.bits.words();
+                for (size_t k = 0; k < CHUNK_BITS / 64; ++k) {
+                    putU32(out, (uint32_t)w[k]);
+                    putU32(out, (uint32_t)(w[k] >> 32));
+                }
+            } else {
+                putU16(out, (uint16_t)(c.runs.size() - 1));
+                for (size_t k = 0; k < c.runs.size(); ++k) {
+                    putU16(out, c.runs[k].start);
+                    putU16(out, c.runs[k].length);
+                }
+            }
+        }
+    }
+
+    // лݲϷʱ false Ҳ޸
+    bool deserialize(const unsigned char* p, size_t n) {
+        const unsigned char* end = p + n;
+        auto need = [&](size_t k) { return (size_t)(end - p) >= k; };
+        auto u16 = [&]() { uint16_t v = (uint16_t)(p[0] | (p[1] << 8)); p += 2; return v; };
+        auto u32 = [&]() {
+            uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+            p += 4;
+            return v;
+        };
+
+        if (!need(8) || memcmp(p, "RBM1", 4) != 0) return false;
+        p += 4;
+        uint32_t count = u32();
+        if (count > 65536) return false;
+
+        RoaringBitmap r;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (!need(7)) return false;
+            uint16_t key = u16();
+            Container c;
+            c.type = *p++;
+            c.card = u32();
+            if ((!r._keys.empty() && key <= r._keys.back()) || c.card == 0 || c.card > CHUNK_BITS) return false;
+            if (c.type == ARRAY) {
+                if (c.card > ARRAY_MAX || !need(2 * (size_t)c.card)) return false;
+                c.array.resize(c.card);
+                for (uint32_t k = 0; k < c.card; ++k) c.array[k] = u16();
+                for (uint32_t k = 1; k < c.card; ++k)
+                    if (c.array[k] <= c.array[k - 1]) return false;
+            } else if (c.type == BITSET) {
+                if (!need(CHUNK_BITS / 8)) return false;
+                c.bits = Bitmap(CHUNK_BITS);
+                uint64_t* w = c.bits.words();
+                for (size_t k = 0; k < CHUNK_BITS / 64; ++k) {
+                    uint64_t lo = u32();
+                    w[k] = lo | ((uint64_t)u32() << 32);
+                }
+                if (c.bits.count() != c.card) return false;
+            } else if (c.type == RUN) {
+                if (!need(2)) return false;
+                size_t nr = (size_t)u16() + 1;
+                if (!need(4 * nr)) return false;
+                c.runs.resize(nr);
+                for (size_t k = 0; k < nr; ++k) {
+                    c.runs[k].start = u16();
+                    c.runs[k].length = u16();
+                    if ((uint32_t)c.runs[k].start + c.runs[k].length >= CHUNK_BITS) return false;
+                    if (k > 0 && c.runs[k].start <= (uint32_t)c.runs[k - 1].start + c.runs[k - 1].length + 1)
+                        return false;
+                }
+                if (runsCard(c.runs) != c.card) return false;
+            } else {
+                return false;
+            }
+            r._keys.push_back(key);
+            r._cont.push_back(c);
+        }
+        if (p != end) return false;
+        _keys.swap(r._keys);
+        _cont.swap(r._cont);
+        return true;
+    }
+};
+
+} // namespace MySTL
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef MYSTL_THREAD_POOL_H
+#define MYSTL_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MySTL {
+
+// ̶߳ fork-join ̳߳أ߳ҲΪ 0 ̲߳
+class ThreadPool {
+private:
+    std::vector<std::thread> _workers;
+    std::mutex _mtx;
+    std::condition_variable _wake;      // ֪ͨ߳
+    std::condition_variable _done;      // ֪ͨ߳
+    std::function<void(int)> _job;
+    unsigned long _generation;          // ÿύһһ
+    int _pending;                       // δɵĹ߳
+    bool _stop;
+    std::mutex _errMtx;
+    std::exception_ptr _error;          // һ׳쳣
+
+    // ֹ
+    ThreadPool(const ThreadPool&);
+    ThreadPool& operator=(const ThreadPool&);
+
+    void workerLoop(int tid) {
+        unsigned long seen = 0;
+        for (;;) {
+            std::function<void(int)> job;
+            {
+                std::unique_lock<std::mutex> lk(_mtx);
+                _wake.wait(lk, [&] { return _stop || _generation != seen; });
+                if (_stop) return;
+                seen = _generation;
+                job = _job;
+            }
+            runSafely(job, tid);
+            std::lock_guard<std::mutex> lk(_mtx);
+            if (--_pending == 0) _done.notify_one();
+        }
+    }
+
+    void runSafely(const std::function<void(int)>& job, int tid) {
+        try {
+            job(tid);
+        } catch (...) {
+            std::lock_guard<std::mutex> lk(_errMtx);
+            if (!_error) _error = std::current_exception();
+        }
+    }
+
+public:
+    // threads <= 0 ʱȡӲ߳
+    explicit ThreadPool(int threads = 0) : _generation(0), _pending(0), _stop(false) {
+        if (threads <= 0) threads = (int)std::max(1u, std::thread::hardware_concurrency());
+        for (int t = 1; t < threads; ++t)
+            _workers.push_back(std::thread(&ThreadPool::workerLoop, this, t));
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lk(_mtx);
+            _stop = true;
+        }
+        _wake.notify_all();
+        for (size_t i = 0; i < _workers.size(); ++i) _workers[i].join();
+    }
+
+    // ̣߳߳
+    int size() const {
+        return (int)_workers.size() + 1;
+    }
+
+    // ÿִ߳һ fn(tid)ȫ󷵻أе쳣ڴ׳
+    void run(const std::function<void(int)>& fn) {
+        if (_workers.empty()) {
+            fn(0);
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lk(_mtx);
+            _job = fn;
+            _pending = (int)_workers.size();
+            _error = nullptr;
+            ++_generation;
+        }
+        _wake.notify_all();
+        runSafely(fn, 0);
+        std::unique_lock<std::mutex> lk(_mtx);
+        _done.wait(lk, [&] { return _pending == 0; });
+        _job = nullptr;
+        if (_error) {
+            std::exception_ptr e = _error;
+            _error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+    //  [0, n) г grain СĿ鶯ָ̬̣߳fn(begin, end, tid)
+    template<typename F>
+    void parallelFor(size_t n, size_t grain, F fn) {
+        if (n == 0) return;
+        if (grain == 0) grain = 1;
+        if (_workers.empty() || n <= grain) {
+            fn((size_t)0, n, 0);
+            return;
+        }
+        std::atomic<size_t> next(0);
+        run([&](int tid) {
+            for (;;) {
+                size_t b = next.fetch_add(grain);
+                if (b >= n) break;
+                fn(b, std::min(n, b + grain), tid);
+            }
+        });
+    }
+};
+
+} // namespace MySTL
+
+#endif
@@ -27,7 +27,7 @@ public:
     }
 
     bool test(int k) {
-        expand(k);
+        if (k >= 8 * (int)M.size()) return false;   // ԽΪ 0
         return (M[k >> 3] & (0x80 >> (k & 0x07)));
     }
 
@@ -96,7 +96,15 @@ Node* buildHuffTree(const vector<int>& freq) {
         p->r = b;
         pq.push(p);
     }
-    return pq.top();
+    return pq.empty() ? NULL : pq.top();
+}
+
+/* ͷ */
+void freeHuffTree(Node* u) {
+    if (!u) return;
+    freeHuffTree(u->l);
+    freeHuffTree(u->r);
+    delete u;
 }
 
 /*====================================================
@@ -174,6 +182,7 @@ int main() {
     for (char c : w2) len2 += HuffCode[c].size();
     cout << "huffman  " << bm2.bits2string(len2) << "\n";
 
+    freeHuffTree(root);
     return 0;
 }
 
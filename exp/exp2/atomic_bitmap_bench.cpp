@@ -0,0 +1,131 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+#include "../../MySTL/atomic_bitmap.h"
+
+using namespace std;
+
+/*====================================================
+    λͼòԣ1~32 ̶߳ͬһλͼ test_and_set
+      mutex   : ֽλͼ + ȫԭ Bitmap Ҫ̰߳ȫֻ
+      fetch_or: ÿֱԭӻ
+      t&s     : ȶԭӻ
+      batch   : ÿ߳ 256 ±ֺ꣬ϲ
+      sorted  : 뱾 CSR ڽӱֱӰֺϲ
+    룺g++ -O2 -pthread atomic_bitmap_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+int main() {
+    const size_t OPS = 1 << 23;          // ÿܲ
+    size_t universes[] = {1 << 12, (size_t)1 << 28};
+    const char* names[] = {"ȵ 4096 λ", "ϡ 2^28 λ"};
+
+    cout << "==== λͼòԣӲ߳ " << thread::hardware_concurrency() << "====" << endl;
+    for (int u = 0; u < 2; ++u) {
+        size_t N = universes[u];
+        vector<size_t> pos(OPS);
+        mt19937_64 rng(2025 + u);
+        for (size_t i = 0; i < OPS; ++i) pos[i] = rng() % N;
+        cout << endl << "--- " << names[u] << " ---" << endl;
+
+        for (int t = 1; t <= 32; t *= 2) {
+            MySTL::ThreadPool pool(t);
+            size_t per = OPS / t;
+
+            // ȫ + ֽλͼ
+            vector<unsigned char> bytes((N + 7) / 8, 0);
+            mutex mtx;
+            vector<size_t> hit(t, 0);
+            double tm = timeMs([&] {
+                pool.run([&](int tid) {
+                    size_t h = 0;
+                    for (size_t i = tid * per; i < (tid + 1) * per; ++i) {
+                        lock_guard<mutex> lk(mtx);
+                        unsigned char m = (unsigned char)(0x80 >> (pos[i] & 7));
+                        if (!(bytes[pos[i] >> 3] & m)) { bytes[pos[i] >> 3] |= m; h++; }
+                    }
+                    hit[tid] = h;
+                });
+            });
+            size_t newMutex = 0;
+            for (int i = 0; i < t; ++i) newMutex += hit[i];
+
+            MySTL::AtomicBitmap a(N), b(N), c(N);
+            double tf = timeMs([&] {
+                pool.run([&](int tid) {
+                    for (size_t i = tid * per; i < (tid + 1) * per; ++i)
+                        a.fetchOr(pos[i] >> 6, 1ULL << (pos[i] & 63));
+                });
+            });
+
+            vector<size_t> got(t, 0);
+            double ts = timeMs([&] {
+                pool.run([&](int tid) {
+                    size_t h = 0;
+                    for (size_t i = tid * per; i < (tid + 1) * per; ++i) h += !b.testAndSet(pos[i]);
+                    got[tid] = h;
+                });
+            });
+            size_t newTS = 0;
+            for (int i = 0; i < t; ++i) newTS += got[i];
+
+            double tb = timeMs([&] {
+                pool.run([&](int tid) {
+                    size_t h = 0;
+                    vector<size_t> buf;
+                    buf.reserve(256);
+                    for (size_t i = tid * per; i < (tid + 1) * per; ++i) {
+                        buf.push_back(pos[i]);
+                        if (buf.size() == 256) {
+                            h += c.setBatchUnsorted(buf);
+                            buf.clear();
+                        }
+                    }
+                    h += c.setBatchUnsorted(buf);
+                    got[tid] = h;
+                });
+            });
+            size_t newBatch = 0;
+            for (int i = 0; i < t; ++i) newBatch += got[i];
+
+            // ÿ 256 һԤź򣬼ʱֻλ
+            MySTL::AtomicBitmap d(N);
+            vector<size_t> sorted(pos);
+            for (size_t i = 0; i < OPS; i += 256) sort(sorted.begin() + i, sorted.begin() + min(OPS, i + 256));
+            double tq = timeMs([&] {
+                pool.run([&](int tid) {
+                    size_t h = 0;
+                    for (size_t i = tid * per; i < (tid + 1) * per; i += 256)
+                        h += d.setBatch(&sorted[i], min((size_t)256, (tid + 1) * per - i));
+                    got[tid] = h;
+                });
+            });
+            size_t newSorted = 0;
+            for (int i = 0; i < t; ++i) newSorted += got[i];
+
+            size_t cnt = 0;
+            double tc = timeMs([&] { cnt = c.count(&pool); });
+            bool ok = newMutex == newTS && newTS == newBatch && newBatch == newSorted
+                   && cnt == newBatch && a.count() == cnt;
+
+            double mops = per * t / 1000.0;
+            printf("߳ %2d | mutex %6.1f | fetch_or %6.1f | t&s %6.1f | batch %6.1f | sorted %6.1f Mop/s"
+                   " | count %.2f ms | %s\n",
+                   t, mops / tm, mops / tf, mops / ts, mops / tb, mops / tq, tc, ok ? "OK" : "һ");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,205 @@
+#ifndef BINTREE_H
+#define BINTREE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/*====================================================
+    
+    -  32 λ±ָ룬int  24 ֽڽ 12 ֽ
+    - 롢ҡݹ飬˻Ҳᱬջ
+    - ʱͷţ delete
+====================================================*/
+template <typename T>
+class BinTree {
+public:
+    static const uint32_t NIL = 0xFFFFFFFFu;
+
+    struct Node {
+        T data;
+        uint32_t left;
+        uint32_t right;
+        Node(const T& val) : data(val), left(NIL), right(NIL) {}
+    };
+
+    BinTree() : root(NIL) {}
+
+    // Ԥ n 㣬ݰ
+    void reserve(size_t n) {
+        nodes.reserve(n);
+    }
+
+    // ظֵŵԭһ
+    void insert(const T& val) {
+        if (nodes.size() >= NIL) throw std::length_error("BinTree: too many nodes");
+        uint32_t id = (uint32_t)nodes.size();
+        nodes.push_back(Node(val));
+        if (root == NIL) {
+            root = id;
+            return;
+        }
+        uint32_t cur = root;
+        for (;;) {
+            Node& p = nodes[cur];
+            uint32_t& next = val < p.data ? p.left : p.right;
+            if (next == NIL) {
+                next = id;
+                return;
+            }
+            cur = next;
+        }
+    }
+
+    bool find(const T& val) const {
+        uint32_t cur = root;
+        while (cur != NIL) {
+            const Node& p = nodes[cur];
+            if (val < p.data) cur = p.left;
+            else if (p.data < val) cur = p.right;
+            else return true;
+        }
+        return false;
+    }
+
+    uint32_t getRoot() const {
+        return root;
+    }
+
+    const Node& node(uint32_t i) const {
+        return nodes[i];
+    }
+
+    size_t size() const {
+        return nodes.size();
+    }
+
+    // ʵռõֽ
+    size_t memoryBytes() const {
+        return nodes.capacity() * sizeof(Node);
+    }
+
+    void clear() {
+        std::vector<Node>().swap(nodes);
+        root = NIL;
+    }
+
+    /*------------------------------------------------
+        Morris ʱÿյָ
+        Ҫջʱָԭ
+    ------------------------------------------------*/
+    template<typename VST>
+    void morrisInOrder(VST visit) {
+        uint32_t cur = root;
+        while (cur != NIL) {
+            if (nodes[cur].left == NIL) {
+                visit(nodes[cur].data);
+                cur = nodes[cur].right;
+                continue;
+            }
+            uint32_t pre = nodes[cur].left;
+            while (nodes[pre].right != NIL && nodes[pre].right != cur) pre = nodes[pre].right;
+            if (nodes[pre].right == NIL) {
+                nodes[pre].right = cur;
+                cur = nodes[cur].left;
+            } else {
+                nodes[pre].right = NIL;
+                visit(nodes[cur].data);
+                cur = nodes[cur].right;
+            }
+        }
+    }
+
+    // ʽջδʵ
+    class InOrderIterator {
+    private:
+        const BinTree* t;
+        std::vector<uint32_t> st;
+
+        void pushLeft(uint32_t x) {
+            while (x != NIL) {
+                st.push_back(x);
+                x = t->nodes[x].left;
+            }
+        }
+
+    public:
+        InOrderIterator(const BinTree* tree, bool atBegin) : t(tree) {
+            if (atBegin) pushLeft(t->root);
+        }
+        const T& operator*() const { return t->nodes[st.back()].data; }
+        InOrderIterator& operator++() {
+            uint32_t x = st.back();
+            st.pop_back();
+            pushLeft(t->nodes[x].right);
+            return *this;
+        }
+        bool operator==(const InOrderIterator& o) const {
+            return st.empty() ? o.st.empty() : (!o.st.empty() && st.back() == o.st.back());
+        }
+        bool operator!=(const InOrderIterator& o) const { return !(*this == o); }
+    };
+
+    // ջǰ㣬ѹҺѹ
+    class PreOrderIterator {
+    private:
+        const BinTree* t;
+        std::vector<uint32_t> st;
+
+    public:
+        PreOrderIterator(const BinTree* tree, bool atBegin) : t(tree) {
+            if (atBegin && t->root != NIL) st.push_back(t->root);
+        }
+        const T& operator*() const { return t->nodes[st.back()].data; }
+        PreOrderIterator& operator++() {
+            const Node& x = t->nodes[st.back()];
+            st.pop_back();
+            if (x.right != NIL) st.push_back(x.right);
+            if (x.left != NIL) st.push_back(x.left);
+            return *this;
+        }
+        bool operator==(const PreOrderIterator& o) const {
+            return st.empty() ? o.st.empty() : (!o.st.empty() && st.back() == o.st.back());
+        }
+        bool operator!=(const PreOrderIterator& o) const { return !(*this == o); }
+    };
+
+    // 鵱Уhead ֮ǰѷ
+    class LevelOrderIterator {
+    private:
+        const BinTree* t;
+        std::vector<uint32_t> q;
+        size_t head;
+
+    public:
+        LevelOrderIterator(const BinTree* tree, bool atBegin) : t(tree), head(0) {
+            if (atBegin && t->root != NIL) q.push_back(t->root);
+        }
+        const T& operator*() const { return t->nodes[q[head]].data; }
+        LevelOrderIterator& operator++() {
+            const Node& x = t->nodes[q[head++]];
+            if (x.left != NIL) q.push_back(x.left);
+            if (x.right != NIL) q.push_back(x.right);
+            return *this;
+        }
+        bool operator==(const LevelOrderIterator& o) const {
+            bool e1 = head == q.size(), e2 = o.head == o.q.size();
+            return e1 || e2 ? e1 == e2 : q[head] == o.q[o.head];
+        }
+        bool operator!=(const LevelOrderIterator& o) const { return !(*this == o); }
+    };
+
+    InOrderIterator inOrderBegin() const { return InOrderIterator(this, true); }
+    InOrderIterator inOrderEnd() const { return InOrderIterator(this, false); }
+    PreOrderIterator preOrderBegin() const { return PreOrderIterator(this, true); }
+    PreOrderIterator preOrderEnd() const { return PreOrderIterator(this, false); }
+    LevelOrderIterator levelOrderBegin() const { return LevelOrderIterator(this, true); }
+    LevelOrderIterator levelOrderEnd() const { return LevelOrderIterator(this, false); }
+
+private:
+    std::vector<Node> nodes;   // ±꼴
+    uint32_t root;
+};
+
+#endif
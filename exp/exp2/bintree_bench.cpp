@@ -0,0 +1,136 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "bintree.h"
+
+using namespace std;
+
+/*====================================================
+    BinTree ڴԣ10^7  int
+      ptr  : ԭʵ֣ÿ㵥 newҺָ룬ݹ
+      arena: ţ 32 λ±꣬
+    ԱȵݹʽջMorris 򡢲
+    룺g++ -O2 bintree_bench.cpp
+====================================================*/
+
+struct PtrNode {
+    int data;
+    PtrNode* left;
+    PtrNode* right;
+    PtrNode(int v) : data(v), left(nullptr), right(nullptr) {}
+};
+
+static PtrNode* ptrInsert(PtrNode* node, int val) {
+    if (node == nullptr) return new PtrNode(val);
+    if (val < node->data) node->left = ptrInsert(node->left, val);
+    else node->right = ptrInsert(node->right, val);
+    return node;
+}
+
+static void ptrInOrder(PtrNode* node, long long& sum) {
+    if (!node) return;
+    ptrInOrder(node->left, sum);
+    sum += node->data;
+    ptrInOrder(node->right, sum);
+}
+
+static void ptrFree(PtrNode* root) {
+    vector<PtrNode*> st;
+    if (root) st.push_back(root);
+    while (!st.empty()) {
+        PtrNode* p = st.back();
+        st.pop_back();
+        if (p->left) st.push_back(p->left);
+        if (p->right) st.push_back(p->right);
+        delete p;
+    }
+}
+
+// ǰ̳פڴ棨MB Linux ãƽ̨ 0
+static double rssMB() {
+    long pages = 0, resident = 0;
+    FILE* f = fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    if (fscanf(f, "%ld %ld", &pages, &resident) != 2) resident = 0;
+    fclose(f);
+    return resident * 4096.0 / 1048576.0;
+}
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+int main() {
+    const int N = 10000000;
+    mt19937 rng(2025);
+    vector<int> vals(N);
+    for (int i = 0; i < N; ++i) vals[i] = (int)(rng() & 0x7fffffff);
+
+    cout << "==== BinTree ڴ n = " << N << " ====" << endl;
+
+    long long refSum = 0;
+    for (int i = 0; i < N; ++i) refSum += vals[i];
+
+    // Ȳ arenaĴͷź黹ϵͳӰ ptr ĳפڴͳ
+    BinTree<int>* t = new BinTree<int>();
+    double m0 = rssMB();
+    t->reserve(N);
+    double ti = timeMs([&] { for (int i = 0; i < N; ++i) t->insert(vals[i]); });
+    double m1 = rssMB();
+    printf("arena  %2zu ֽ  פ %7.1f MB   %8.1f ms %.1f MB\n",
+           sizeof(BinTree<int>::Node), m1 - m0, ti, t->memoryBytes() / 1048576.0);
+
+    long long s1 = 0, s2 = 0, s3 = 0, s4 = 0;
+    int prev = -1;
+    bool sorted = true;
+    double tIn = timeMs([&] {
+        for (BinTree<int>::InOrderIterator it = t->inOrderBegin(); it != t->inOrderEnd(); ++it) {
+            if (*it < prev) sorted = false;
+            prev = *it;
+            s1 += *it;
+        }
+    });
+    double tMo = timeMs([&] { t->morrisInOrder([&](const int& v) { s2 += v; }); });
+    double tPre = timeMs([&] {
+        for (BinTree<int>::PreOrderIterator it = t->preOrderBegin(); it != t->preOrderEnd(); ++it) s3 += *it;
+    });
+    double tLv = timeMs([&] {
+        for (BinTree<int>::LevelOrderIterator it = t->levelOrderBegin(); it != t->levelOrderEnd(); ++it) s4 += *it;
+    });
+    bool ok = sorted && s1 == refSum && s2 == refSum && s3 == refSum && s4 == refSum;
+    printf("arena  %7.1f ms  Morris %7.1f ms   %7.1f ms   %7.1f ms  %s\n",
+           tIn, tMo, tPre, tLv, ok ? "OK" : "һ");
+
+    size_t hit = 0;
+    double tf = timeMs([&] { for (int i = 0; i < N; ++i) hit += t->find(vals[i]); });
+    double tr = timeMs([&] { delete t; });
+    printf("arena  %8.1f ms %zu  ͷ %7.1f ms\n", tf, hit, tr);
+
+    long long ptrSum = 0;
+    {
+        double m0 = rssMB();
+        PtrNode* root = nullptr;
+        double ti = timeMs([&] { for (int i = 0; i < N; ++i) root = ptrInsert(root, vals[i]); });
+        double m1 = rssMB();
+        double tv = timeMs([&] { ptrInOrder(root, ptrSum); });
+        printf("ptr    %2zu ֽ  פ %7.1f MB   %8.1f ms  ݹ %7.1f ms\n",
+               sizeof(PtrNode), m1 - m0, ti, tv);
+        double tpf = timeMs([&] { ptrFree(root); });
+        printf("ptr   ͷ %7.1f ms  %s\n", tpf, ptrSum == refSum ? "OK" : "һ");
+    }
+
+    // ˻Σԭݹʵֻջֻ֤
+    BinTree<int> chain;
+    for (int i = 0; i < 200000 && i < N; ++i) chain.insert(i);
+    long long c = 0;
+    for (BinTree<int>::InOrderIterator it = chain.inOrderBegin(); it != chain.inOrderEnd(); ++it) c++;
+    printf(" %d 㣨״ %lld  %s\n", 200000, c, c == 200000 ? "OK" : "һ");
+    return ok ? 0 : 1;
+}
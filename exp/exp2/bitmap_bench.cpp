@@ -0,0 +1,141 @@
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include <random>
+
+#include "../../MySTL/bitmap.h"
+
+using namespace std;
+
+/*====================================================
+    64 λλͼ vs ԭλֽλͼ
+    룺g++ -O2 -mavx2 -mpopcnt -mbmi2 bitmap_bench.cpp
+====================================================*/
+
+// exp2-1.cpp дvector<unsigned char>λ
+class ByteBitmap {
+private:
+    vector<unsigned char> M;
+public:
+    ByteBitmap(int n = 8) {
+        M.assign((n + 7) / 8, 0);
+    }
+    void set(int k) {
+        M[k >> 3] |= (0x80 >> (k & 0x07));
+    }
+    void clear(int k) {
+        M[k >> 3] &= ~(0x80 >> (k & 0x07));
+    }
+    bool test(int k) const {
+        return (M[k >> 3] & (0x80 >> (k & 0x07))) != 0;
+    }
+};
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static void report(const char* name, double byteMs, double wordMs, bool ok) {
+    printf("%-22s ֽλͼ %9.3f ms | λͼ %9.3f ms | x%7.1f | %s\n",
+           name, byteMs, wordMs, wordMs > 0 ? byteMs / wordMs : 0.0, ok ? "OK" : "һ");
+}
+
+int main() {
+    const int N = 1 << 26;          // 6400 λ
+    const int M = 1 << 22;          // 
+    mt19937 rng(2025);
+    vector<int> pos(M);
+    for (int i = 0; i < M; ++i) pos[i] = (int)(rng() % N);
+
+    ByteBitmap ba(N), bb(N);
+    MySTL::Bitmap wa(N), wb(N);
+
+    cout << "==== λͼܲ N = " << N << " λ ====" << endl;
+
+    double t1 = timeMs([&] { for (int i = 0; i < M; ++i) ba.set(pos[i]); });
+    double t2 = timeMs([&] { for (int i = 0; i < M; ++i) wa.set(pos[i]); });
+    report(" set", t1, t2, true);
+
+    size_t hb = 0, hw = 0;
+    t1 = timeMs([&] { for (int i = 0; i < M; ++i) hb += ba.test(pos[M - 1 - i] ^ 1); });
+    t2 = timeMs([&] { for (int i = 0; i < M; ++i) hw += wa.test(pos[M - 1 - i] ^ 1); });
+    report(" test", t1, t2, hb == hw);
+
+    // λһλ
+    t1 = timeMs([&] { for (int k = N / 4; k < N / 2; ++k) bb.set(k); });
+    t2 = timeMs([&] { wb.setRange(N / 4, N / 2); });
+    report("set_range (N/4 λ)", t1, t2, true);
+
+    size_t cb = 0, cw = 0;
+    t1 = timeMs([&] { for (int k = 0; k < N; ++k) cb += ba.test(k); });
+    t2 = timeMs([&] { cw = wa.count(); });
+    report("count", t1, t2, cb == cw);
+
+    //  ANDֽλͼֻλ
+    ByteBitmap bc(N);
+    MySTL::Bitmap wc = wa;
+    t1 = timeMs([&] { for (int k = 0; k < N; ++k) if (ba.test(k) && bb.test(k)) bc.set(k); });
+    t2 = timeMs([&] { wc &= wb; });
+    size_t cc = 0;
+    for (int k = 0; k < N; ++k) cc += bc.test(k);
+    report("AND", t1, t2, cc == wc.count());
+
+    MySTL::Bitmap wd = wa;
+    t2 = timeMs([&] { wd |= wb; });
+    report("OR", t1, t2, wd.count() == wa.count() + wb.count() - wc.count());
+    wd = wa;
+    t2 = timeMs([&] { wd ^= wb; });
+    report("XOR", t1, t2, wd.count() == wa.count() + wb.count() - 2 * wc.count());
+    wd = wa;
+    t2 = timeMs([&] { wd.andNot(wb); });
+    report("ANDNOT", t1, t2, wd.count() == wa.count() - wc.count());
+
+    // Ȳͬ ANDλͼ֮λ
+    {
+        MySTL::Bitmap longer(N), shorter(N / 2 + 5);
+        longer.setRange(0, N);
+        shorter.setRange(N / 4, N / 2 + 5);
+        longer &= shorter;
+        bool same = longer.count() == shorter.count() && longer.findFirst() == (size_t)N / 4 &&
+                    !longer.test(N / 2 + 5) && !longer.test(N - 1);
+        printf("%-22s %s\n", "ͬ AND", same ? "OK" : "һ");
+    }
+
+    // λ
+    size_t sb = 0, sw = 0;
+    t1 = timeMs([&] { for (int k = 0; k < N; ++k) if (ba.test(k)) sb += k; });
+    t2 = timeMs([&] { for (size_t k = wa.findFirst(); k != MySTL::Bitmap::npos; k = wa.findNext(k + 1)) sw += k; });
+    report("findNext ", t1, t2, sb == sw);
+    size_t sf = 0;
+    t2 = timeMs([&] { wa.forEach([&](size_t k) { sf += k; }); });
+    report("forEach ", t1, t2, sb == sf);
+
+    // rank/selectΪͷɨ
+    MySTL::BitmapRank rk(wa);
+    const int Q = 1 << 20;
+    vector<size_t> qpos(Q), qk(Q);
+    for (int i = 0; i < Q; ++i) {
+        qpos[i] = rng() % N;
+        qk[i] = rng() % rk.ones();
+    }
+    double tb = timeMs([&] { MySTL::BitmapRank tmp(wa); });
+    size_t rs = 0, ss = 0;
+    t2 = timeMs([&] { for (int i = 0; i < Q; ++i) rs += rk.rank1(qpos[i]); });
+    double t3 = timeMs([&] { for (int i = 0; i < Q; ++i) ss += rk.select1(qk[i]); });
+    bool ok = true;
+    for (int i = 0; i < 64; ++i) {
+        size_t p = qpos[i], c = 0;
+        for (size_t k = 0; k < p; ++k) c += ba.test((int)k);
+        if (c != rk.rank1(p)) ok = false;
+        size_t s = rk.select1(qk[i]);
+        if (!wa.test(s) || rk.rank1(s) != qk[i]) ok = false;
+    }
+    printf("rank/select  %.3f ms | rank1 %.1f ns/ | select1 %.1f ns/ | %s\n",
+           tb, t2 * 1e6 / Q, t3 * 1e6 / Q, ok ? "OK" : "һ");
+    return (rs + ss) == 0;
+}
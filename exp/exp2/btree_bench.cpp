@@ -0,0 +1,125 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdint>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "bintree.h"
+#include "../../MySTL/btree.h"
+
+using namespace std;
+
+/*====================================================
+    ṹԱȣ
+      BinTree : ƽʱ˻
+      std::map: 
+      BTreeMap: B+ ڵСУ64 ֽڣѡȡ
+    ֱ / 롢ҡɾɨ
+    룺g++ -O2 btree_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static void runCase(const char* name, const vector<uint64_t>& keys, bool withBin) {
+    size_t n = keys.size();
+    vector<uint64_t> probe(keys);
+    shuffle(probe.begin(), probe.end(), mt19937_64(7));
+    printf("\n--- %s  n = %zu ---\n", name, n);
+
+    // BinTree
+    if (withBin) {
+        BinTree<uint64_t> bt;
+        bt.reserve(n);
+        double ti = timeMs([&] { for (size_t i = 0; i < n; ++i) bt.insert(keys[i]); });
+        size_t hit = 0;
+        double tf = timeMs([&] { for (size_t i = 0; i < n; ++i) hit += bt.find(probe[i]); });
+        printf("BinTree    %9.1f ms   %9.1f ms   %zu\n", ti, tf, hit);
+    }
+
+    // std::map
+    size_t mapRange = 0;
+    {
+        map<uint64_t, uint64_t> m;
+        double ti = timeMs([&] { for (size_t i = 0; i < n; ++i) m.insert(make_pair(keys[i], i)); });
+        size_t hit = 0;
+        double tf = timeMs([&] { for (size_t i = 0; i < n; ++i) hit += m.count(probe[i]); });
+        double tr = timeMs([&] {
+            for (map<uint64_t, uint64_t>::iterator it = m.begin(); it != m.end(); ++it) mapRange += it->second;
+        });
+        double te = timeMs([&] { for (size_t i = 0; i < n; i += 2) m.erase(probe[i]); });
+        printf("std::map   %9.1f ms   %9.1f ms   %7.1f ms  ɾ %9.1f ms   %zu\n",
+               ti, tf, tr, te, hit);
+    }
+
+    // BTreeMap
+    {
+        MySTL::BTreeMap<uint64_t, uint64_t> t;
+        double ti = timeMs([&] { for (size_t i = 0; i < n; ++i) t.insert(keys[i], i); });
+        size_t hit = 0;
+        double tf = timeMs([&] { for (size_t i = 0; i < n; ++i) hit += t.contains(probe[i]); });
+        size_t sum = 0;
+        double tr = timeMs([&] {
+            for (MySTL::BTreeMap<uint64_t, uint64_t>::iterator it = t.begin(); it != t.end(); ++it)
+                sum += it.value();
+        });
+        int h = t.height();
+        double te = timeMs([&] { for (size_t i = 0; i < n; i += 2) t.erase(probe[i]); });
+
+        // ȷԣʣµǡδɾһ룬
+        vector<uint64_t> rest;
+        for (size_t i = 1; i < n; i += 2) rest.push_back(probe[i]);
+        sort(rest.begin(), rest.end());
+        bool ok = sum == mapRange && t.size() == rest.size();
+        size_t k = 0;
+        for (MySTL::BTreeMap<uint64_t, uint64_t>::iterator it = t.begin(); ok && it != t.end(); ++it, ++k)
+            ok = k < rest.size() && it.key() == rest[k];
+        ok = ok && k == rest.size();
+        printf("BTreeMap   %9.1f ms   %9.1f ms   %7.1f ms  ɾ %9.1f ms   %zu   %d  %s\n",
+               ti, tf, tr, te, hit, h, ok ? "OK" : "һ");
+
+        //  + ѯ
+        vector<pair<uint64_t, uint64_t> > items(n);
+        vector<uint64_t> sorted(keys);
+        sort(sorted.begin(), sorted.end());
+        for (size_t i = 0; i < n; ++i) items[i] = make_pair(sorted[i], i);
+        double tb = timeMs([&] { t.bulkLoad(items); });
+        size_t cnt = 0;
+        mt19937_64 rng(11);
+        double tq = timeMs([&] {
+            for (int q = 0; q < 100000; ++q) {
+                uint64_t lo = sorted[rng() % n];
+                t.forRange(lo, lo + 1000000, [&](const uint64_t&, uint64_t&) { cnt++; });
+            }
+        });
+        printf("BTreeMap   %7.1f ms   %d  10^5 ѯ %7.1f ms %zu \n",
+               tb, t.height(), tq, cnt);
+    }
+}
+
+int main() {
+    const size_t N = 10000000;
+    mt19937_64 rng(2025);
+
+    cout << "==== ṹܲ ====" << endl;
+    vector<uint64_t> rnd(N);
+    for (size_t i = 0; i < N; ++i) rnd[i] = rng() >> 16;
+    sort(rnd.begin(), rnd.end());
+    rnd.erase(unique(rnd.begin(), rnd.end()), rnd.end());
+    vector<uint64_t> sorted(rnd);
+    shuffle(rnd.begin(), rnd.end(), rng);
+    runCase("", rnd, true);
+    runCase("", sorted, false);
+
+    //  BinTree ˻ƽֻСģ϶Ա
+    vector<uint64_t> small(sorted.begin(), sorted.begin() + 20000);
+    runCase("루Сģ BinTree", small, true);
+    return 0;
+}
@@ -7,43 +7,9 @@
 #include <bitset>
 #include <cstring>  //  memset 
 
-using namespace std;
-
-// ݽṹ
-template <typename T>
-class BinTree {
-public:
-    struct Node {
-        T data;
-        Node* left;
-        Node* right;
-        Node(T val) : data(val), left(nullptr), right(nullptr) {}
-    };
-
-    BinTree() : root(nullptr) {}
-
-    void insert(T val) {
-        root = insert(root, val);
-    }
-
-    Node* getRoot() {
-        return root;
-    }
-
-private:
-    Node* root;
-
-    Node* insert(Node* node, T val) {
-        if (node == nullptr)
-            return new Node(val);
+#include "bintree.h"
 
-        if (val < node->data)
-            node->left = insert(node->left, val);
-        else
-            node->right = insert(node->right, val);
-        return node;
-    }
-};
+using namespace std;
 
 // ڵ
 struct HuffmanNode {
@@ -60,13 +26,24 @@ struct HuffmanNode {
     }
 };
 
+// ȶָ룬밴ָڵƵʱȽ
+struct HuffmanNodeGreater {
+    bool operator()(const HuffmanNode* a, const HuffmanNode* b) const {
+        return *a > *b;
+    }
+};
+
 // 
 class HuffmanTree {
 public:
-    HuffmanTree(const string& str) {
+    HuffmanTree(const string& str) : root(nullptr) {
         buildTree(str);
     }
 
+    ~HuffmanTree() {
+        destroy(root);
+    }
+
     void buildTree(const string& str) {
         unordered_map<char, int> freq;
         for (char c : str) {
@@ -76,7 +53,7 @@ public:
         }
 
         // ʹȶУ
-        priority_queue<HuffmanNode*, vector<HuffmanNode*>, greater<HuffmanNode*>> pq;
+        priority_queue<HuffmanNode*, vector<HuffmanNode*>, HuffmanNodeGreater> pq;
         for (auto& pair : freq) {
             pq.push(new HuffmanNode(pair.first, pair.second));
         }
@@ -94,7 +71,7 @@ public:
             pq.push(parent);
         }
 
-        root = pq.top();
+        root = pq.empty() ? nullptr : pq.top();
     }
 
     // ݹɹ
@@ -118,6 +95,17 @@ public:
 
 private:
     HuffmanNode* root;
+
+    // ֹظͷ
+    HuffmanTree(const HuffmanTree&);
+    HuffmanTree& operator=(const HuffmanTree&);
+
+    void destroy(HuffmanNode* node) {
+        if (node == nullptr) return;
+        destroy(node->left);
+        destroy(node->right);
+        delete node;
+    }
 };
 
 // λͼ
@@ -148,16 +136,16 @@ public:
         if (k < 0) return;
         int byteIndex = k / 8;
         int bitIndex = k % 8;
+        if (!(M[byteIndex] & (1 << (7 - bitIndex)))) _sz++;  // ظλظ
         M[byteIndex] |= (1 << (7 - bitIndex));
-        _sz++;
     }
 
     void clear(int k) {
         if (k < 0) return;
         int byteIndex = k / 8;
         int bitIndex = k % 8;
+        if (M[byteIndex] & (1 << (7 - bitIndex))) _sz--;
         M[byteIndex] &= ~(1 << (7 - bitIndex));
-        _sz--;
     }
 
     bool test(int k) {
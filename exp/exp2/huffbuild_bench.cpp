@@ -0,0 +1,121 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include <algorithm>
+#include <random>
+
+#include "huffman_build.h"
+
+using namespace std;
+
+/*====================================================
+    볤ܶԱȣ
+      ptr-pq :  buildHuffTree new ڵ + ȶ + DFS
+      linear : һ + MoffatCKatajainen ԭ·鲢
+      pkg-mrg: package-merge ޳
+====================================================*/
+
+struct PNode {
+    uint64_t w;
+    int sym;
+    PNode *l, *r;
+    PNode(int s, uint64_t w_) : w(w_), sym(s), l(nullptr), r(nullptr) {}
+};
+
+struct PCmp {
+    bool operator()(PNode* a, PNode* b) const {
+        return a->w > b->w;
+    }
+};
+
+// ʽջȲͷŽڵ㣬ݹ
+static void collectAndFree(PNode* root, vector<unsigned char>& len) {
+    vector<pair<PNode*, int> > st;
+    st.push_back(make_pair(root, 0));
+    while (!st.empty()) {
+        PNode* u = st.back().first;
+        int d = st.back().second;
+        st.pop_back();
+        if (!u->l && !u->r) len[u->sym] = (unsigned char)d;
+        if (u->l) st.push_back(make_pair(u->l, d + 1));
+        if (u->r) st.push_back(make_pair(u->r, d + 1));
+        delete u;
+    }
+}
+
+static void pointerLengths(const vector<uint64_t>& freq, vector<unsigned char>& len) {
+    len.assign(freq.size(), 0);
+    priority_queue<PNode*, vector<PNode*>, PCmp> pq;
+    for (size_t s = 0; s < freq.size(); ++s)
+        if (freq[s] > 0) pq.push(new PNode((int)s, freq[s]));
+    while (pq.size() > 1) {
+        PNode* a = pq.top(); pq.pop();
+        PNode* b = pq.top(); pq.pop();
+        PNode* p = new PNode(-1, a->w + b->w);
+        p->l = a;
+        p->r = b;
+        pq.push(p);
+    }
+    collectAndFree(pq.top(), len);
+}
+
+static double cost(const vector<uint64_t>& freq, const vector<unsigned char>& len) {
+    double c = 0;
+    for (size_t s = 0; s < freq.size(); ++s) c += (double)freq[s] * len[s];
+    return c;
+}
+
+static bool kraftOK(const vector<unsigned char>& len) {
+    double k = 0;
+    for (size_t s = 0; s < len.size(); ++s)
+        if (len[s]) k += ldexp(1.0, -len[s]);
+    return k <= 1.0 + 1e-12;
+}
+
+template<typename F>
+static double timeUs(int rounds, F fn) {
+    auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) fn();
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - t0).count() / rounds;
+}
+
+int main() {
+    mt19937_64 rng(2025);
+    int sizes[] = {256, 1024, 4096, 16384, 65536};
+    double skews[] = {1.0, 2.0};
+
+    cout << "==== Huffman 볤ܲ ====" << endl;
+    for (int si = 0; si < 5; ++si) {
+        int n = sizes[si];
+        int lg = 0;
+        while ((1 << lg) < n) lg++;
+        int maxLen = lg + 3;
+
+        for (int ki = 0; ki < 2; ++ki) {
+            // Zipf ֲƵʣҷ˳
+            vector<uint64_t> freq(n);
+            for (int i = 0; i < n; ++i)
+                freq[i] = max<uint64_t>(1, (uint64_t)(1e12 / pow(i + 1.0, skews[ki])));
+            shuffle(freq.begin(), freq.end(), rng);
+
+            vector<unsigned char> lp, ll(n), lm(n);
+            int rounds = max(3, 2000000 / n);
+            double tp = timeUs(rounds, [&] { pointerLengths(freq, lp); });
+            double tl = timeUs(rounds, [&] { huffmanLengths(&freq[0], n, 0, &ll[0]); });
+            double tm = timeUs(rounds, [&] { huffmanLengths(&freq[0], n, maxLen, &lm[0]); });
+
+            int maxL = *max_element(ll.begin(), ll.end());
+            int maxM = *max_element(lm.begin(), lm.end());
+            bool ok = cost(freq, lp) == cost(freq, ll) && kraftOK(ll) && kraftOK(lm) && maxM <= maxLen;
+            printf("n=%6d zipf=%.1f | ptr-pq %9.1f us | linear %9.1f us (x%.1f,  %2d) | "
+                   "pkg-mrg(L=%2d) %9.1f us,  +%.4f%% | %s\n",
+                   n, skews[ki], tp, tl, tp / tl, maxL, maxLen, tm,
+                   100.0 * (cost(freq, lm) / cost(freq, ll) - 1.0), ok ? "OK" : "");
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+#ifndef HUFFMAN_BUILD_H
+#define HUFFMAN_BUILD_H
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+/*====================================================
+    Huffman 볤㣨ָڵ new
+
+    1. Ƶһ
+    2. MoffatCKatajainen ԭ㷨ͬһ
+       ҶӶ + ڲڵС·鲢˵ȣO(n)
+    3. 볬ʱ package-merge ޳룬O(nL)
+====================================================*/
+
+/*----------------------------------------------------
+    A[0..n-1] ΪƵʣԭظдΪλõ볤
+    غ A[i] Ƶҡ̣
+----------------------------------------------------*/
+inline void inPlaceCodeLengths(uint64_t* A, int n) {
+    if (n == 0) return;
+    if (n == 1) {
+        A[0] = 0;
+        return;
+    }
+
+    // һˣ·鲢A[next] ڲڵȨֵ
+    // ϲڲڵλøĴ丸ڵ±
+    A[0] += A[1];
+    int root = 0, leaf = 2;
+    for (int next = 1; next < n - 1; ++next) {
+        if (leaf >= n || A[root] < A[leaf]) {
+            A[next] = A[root];
+            A[root++] = next;
+        } else {
+            A[next] = A[leaf++];
+        }
+        if (leaf >= n || (root < next && A[root] < A[leaf])) {
+            A[next] += A[root];
+            A[root++] = next;
+        } else {
+            A[next] += A[leaf++];
+        }
+    }
+
+    // ڶˣ󣬸ָ뻻ڲڵ
+    A[n - 2] = 0;
+    for (int next = n - 3; next >= 0; --next) A[next] = A[A[next]] + 1;
+
+    // ˣͳƿλãҶд
+    int avbl = 1, used = 0, dpth = 0;
+    int root2 = n - 2, next = n - 1;
+    while (avbl > 0) {
+        while (root2 >= 0 && A[root2] == (uint64_t)dpth) {
+            used++;
+            root2--;
+        }
+        while (avbl > used) {
+            A[next--] = dpth;
+            avbl--;
+        }
+        avbl = 2 * used;
+        dpth++;
+        used = 0;
+    }
+}
+
+/*----------------------------------------------------
+    package-mergew[0..n-1] 볤 maxLen 
+     j б = Ҷ   j-1  Ĺ鲢
+    һȡǰ 2n-2 ݣѡеҶǰ׺
+    ֻÿѡ˼ƬҶ
+----------------------------------------------------*/
+inline void packageMergeLengths(const uint64_t* w, int n, int maxLen, unsigned char* len) {
+    for (int i = 0; i < n; ++i) len[i] = 0;
+    if (n <= 1) {
+        if (n == 1) len[0] = 1;
+        return;
+    }
+
+    std::vector<std::vector<uint64_t> > weight(maxLen);
+    std::vector<std::vector<unsigned char> > isLeaf(maxLen);
+    weight[0].assign(w, w + n);
+    isLeaf[0].assign(n, 1);
+
+    for (int j = 1; j < maxLen; ++j) {
+        const std::vector<uint64_t>& prev = weight[j - 1];
+        size_t packs = prev.size() / 2;
+        std::vector<uint64_t>& cur = weight[j];
+        std::vector<unsigned char>& leafFlag = isLeaf[j];
+        cur.reserve(n + packs);
+        leafFlag.reserve(n + packs);
+        size_t a = 0, b = 0;
+        while (a < (size_t)n || b < packs) {
+            uint64_t pw = b < packs ? prev[2 * b] + prev[2 * b + 1] : 0;
+            if (b >= packs || (a < (size_t)n && w[a] <= pw)) {
+                cur.push_back(w[a++]);
+                leafFlag.push_back(1);
+            } else {
+                cur.push_back(pw);
+                leafFlag.push_back(0);
+                b++;
+            }
+        }
+    }
+
+    // ݣѡ take Ҷ leaves Ƭһ 2*packs 
+    size_t take = 2 * (size_t)n - 2;
+    for (int j = maxLen - 1; j >= 0 && take > 0; --j) {
+        size_t leaves = 0;
+        for (size_t k = 0; k < take; ++k) leaves += isLeaf[j][k];
+        for (size_t k = 0; k < leaves; ++k) len[k]++;
+        take = 2 * (take - leaves);
+    }
+}
+
+/*----------------------------------------------------
+    ͨڣfreq[0..n-1]n  65536len[s] = 0 ʾδ
+    maxLen <= 0 ʾ޳
+----------------------------------------------------*/
+inline void huffmanLengths(const uint64_t* freq, int n, int maxLen, unsigned char* len) {
+    std::vector<uint32_t> syms;
+    for (int s = 0; s < n; ++s) {
+        len[s] = 0;
+        if (freq[s] > 0) syms.push_back((uint32_t)s);
+    }
+    int m = (int)syms.size();
+    if (m == 0) return;
+    if (m == 1) {      // ֻһҲҪռ 1 bit
+        len[syms[0]] = 1;
+        return;
+    }
+    if (maxLen > 0 && maxLen < 31 && ((int64_t)1 << maxLen) < m)
+        throw std::invalid_argument("huffman: maxLen too small for alphabet");
+
+    // Ψһһ򣺰ƵͬƵź
+    std::sort(syms.begin(), syms.end(), [&](uint32_t a, uint32_t b) {
+        return freq[a] != freq[b] ? freq[a] < freq[b] : a < b;
+    });
+    std::vector<uint64_t> A(m);
+    for (int i = 0; i < m; ++i) A[i] = freq[syms[i]];
+    inPlaceCodeLengths(&A[0], m);
+
+    // A[0] Ƶŵ볤Ҳ
+    if (maxLen <= 0 || A[0] <= (uint64_t)maxLen) {
+        for (int i = 0; i < m; ++i) len[syms[i]] = (unsigned char)A[i];
+        return;
+    }
+    std::vector<uint64_t> w(m);
+    std::vector<unsigned char> l(m);
+    for (int i = 0; i < m; ++i) w[i] = freq[syms[i]];
+    packageMergeLengths(&w[0], m, maxLen, &l[0]);
+    for (int i = 0; i < m; ++i) len[syms[i]] = l[i];
+}
+
+#endif
@@ -0,0 +1,390 @@
+#ifndef HUFFMAN_CODEC_H
+#define HUFFMAN_CODEC_H
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+#include "huffman_build.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    ֽڼ Huffman 루256 ţ޳ʽ룩
+
+    ļʽСˣ
+      ļͷ 16B : "HUFZ" | 汾 u8 | С log2 u8 |  u16 | ԭʼ u64
+      ÿ       : ԭʼ u32 | غɳ u32 | ģʽ u8
+                   ģʽ 1Huffman128B 볤ÿ 4 bit+ 
+                   ģʽ 0ԭ洢ԭʼֽ
+      (v2) : ÿƫ u64 ... |  u64 | "HIDX"
+====================================================*/
+
+const int HUFF_SYMBOLS = 256;
+const int HUFF_MAX_LEN = 12;                 // 볤ޣ 2^12 
+const int HUFF_LEN_TABLE_BYTES = HUFF_SYMBOLS / 2;
+const int HUFF_FILE_HEADER = 16;
+const int HUFF_BLOCK_HEADER = 9;
+const int HUFF_INDEX_TRAILER = 12;
+const unsigned char HUFF_VERSION = 2;
+
+enum HuffBlockMode {
+    HUFF_STORED = 0,
+    HUFF_CODED = 1
+};
+
+/*====================================================
+    С˶д
+====================================================*/
+inline void putU32(unsigned char* p, uint32_t v) {
+    for (int i = 0; i < 4; ++i) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+inline void putU64(unsigned char* p, uint64_t v) {
+    for (int i = 0; i < 8; ++i) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+inline uint32_t getU32(const unsigned char* p) {
+    uint32_t v = 0;
+    for (int i = 3; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+inline uint64_t getU64(const unsigned char* p) {
+    uint64_t v = 0;
+    for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+    return v;
+}
+
+/*====================================================
+    ͳ 256 ֽڵƵ
+    4 ӱۼӣֽͬڵд
+====================================================*/
+inline void countByteFreq(const unsigned char* src, size_t n, uint64_t freq[HUFF_SYMBOLS]) {
+    uint32_t h[4][HUFF_SYMBOLS];
+    memset(h, 0, sizeof(h));
+    for (int s = 0; s < HUFF_SYMBOLS; ++s) freq[s] = 0;
+
+    // ÿβ 2^30 ֽڣӱ
+    while (n > 0) {
+        size_t len = std::min(n, (size_t)1 << 30);
+        size_t i = 0;
+        for (; i + 4 <= len; i += 4) {
+            h[0][src[i]]++;
+            h[1][src[i + 1]]++;
+            h[2][src[i + 2]]++;
+            h[3][src[i + 3]]++;
+        }
+        for (; i < len; ++i) h[0][src[i]]++;
+        for (int s = 0; s < HUFF_SYMBOLS; ++s) {
+            freq[s] += (uint64_t)h[0][s] + h[1][s] + h[2][s] + h[3][s];
+            h[0][s] = h[1][s] = h[2][s] = h[3][s] = 0;
+        }
+        src += len;
+        n -= len;
+    }
+}
+
+/*====================================================
+    Ƶ볤len[s] = 0 ʾδ֣
+    ʱ佨 maxLen ʱ package-merge ޳
+====================================================*/
+inline void buildCodeLengths(const uint64_t freq[HUFF_SYMBOLS], int maxLen, unsigned char len[HUFF_SYMBOLS]) {
+    huffmanLengths(freq, HUFF_SYMBOLS, maxLen, len);
+}
+
+/*====================================================
+    ʽ룺ͬڰ˳
+     LSB дԴλת
+====================================================*/
+inline void buildCanonicalCodes(const unsigned char len[HUFF_SYMBOLS], uint16_t code[HUFF_SYMBOLS]) {
+    int count[HUFF_MAX_LEN + 1] = {0};
+    for (int s = 0; s < HUFF_SYMBOLS; ++s) count[len[s]]++;
+    count[0] = 0;
+
+    uint32_t nextCode[HUFF_MAX_LEN + 2] = {0};
+    uint32_t c = 0;
+    for (int l = 1; l <= HUFF_MAX_LEN; ++l) {
+        c = (c + count[l - 1]) << 1;
+        nextCode[l] = c;
+    }
+    for (int s = 0; s < HUFF_SYMBOLS; ++s) {
+        int l = len[s];
+        code[s] = 0;
+        if (l == 0) continue;
+        uint32_t v = nextCode[l]++;
+        uint32_t r = 0;
+        for (int i = 0; i < l; ++i) r |= ((v >> i) & 1u) << (l - 1 - i);
+        code[s] = (uint16_t)r;
+    }
+}
+
+// 볤ϷԼ飨ļʱֹĽԽ磩
+inline bool validCodeLengths(const unsigned char len[HUFF_SYMBOLS]) {
+    int64_t kraft = 0;
+    int used = 0;
+    for (int s = 0; s < HUFF_SYMBOLS; ++s) {
+        if (len[s] > HUFF_MAX_LEN) return false;
+        if (len[s] == 0) continue;
+        kraft += (int64_t)1 << (HUFF_MAX_LEN - len[s]);
+        used++;
+    }
+    return used > 0 && kraft <= ((int64_t)1 << HUFF_MAX_LEN);
+}
+
+/*====================================================
+    룺д out ֽ
+    out Ԥ huffBlockBound(n) ֽ
+====================================================*/
+inline size_t huffBlockBound(size_t n) {
+    return HUFF_BLOCK_HEADER + HUFF_LEN_TABLE_BYTES + n * HUFF_MAX_LEN / 8 + 16;
+}
+
+inline size_t huffEncodeBlockWith(const unsigned char* src, uint32_t n,
+                                  const unsigned char len[HUFF_SYMBOLS],
+                                  unsigned char* out) {
+    uint16_t code[HUFF_SYMBOLS];
+    buildCanonicalCodes(len, code);
+
+    unsigned char* p = out + HUFF_BLOCK_HEADER;
+    for (int s = 0; s < HUFF_SYMBOLS; s += 2)
+        *p++ = (unsigned char)(len[s] | (len[s + 1] << 4));
+
+    // 64 λۼ 32 λдһ
+    uint64_t acc = 0;
+    int nbits = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+        unsigned char c = src[i];
+        acc |= (uint64_t)code[c] << nbits;
+        nbits += len[c];
+        if (nbits >= 32) {
+            putU32(p, (uint32_t)acc);
+            p += 4;
+            acc >>= 32;
+            nbits -= 32;
+        }
+    }
+    while (nbits > 0) {
+        *p++ = (unsigned char)acc;
+        acc >>= 8;
+        nbits -= 8;
+    }
+
+    size_t payload = (size_t)(p - out) - HUFF_BLOCK_HEADER;
+    // ѹԭ洢
+    if (payload >= n) {
+        memcpy(out + HUFF_BLOCK_HEADER, src, n);
+        putU32(out, n);
+        putU32(out + 4, n);
+        out[8] = HUFF_STORED;
+        return HUFF_BLOCK_HEADER + n;
+    }
+    putU32(out, n);
+    putU32(out + 4, (uint32_t)payload);
+    out[8] = HUFF_CODED;
+    return HUFF_BLOCK_HEADER + payload;
+}
+
+inline size_t huffEncodeBlock(const unsigned char* src, uint32_t n, unsigned char* out) {
+    uint64_t freq[HUFF_SYMBOLS];
+    unsigned char len[HUFF_SYMBOLS];
+    countByteFreq(src, n, freq);
+    buildCodeLengths(freq, HUFF_MAX_LEN, len);
+    return huffEncodeBlockWith(src, n, len, out);
+}
+
+/*====================================================
+    룺һβõ (, 볤)
+    src ָͷռõֽ
+====================================================*/
+inline size_t huffDecodeBlock(const unsigned char* src, size_t avail, unsigned char* dst, uint32_t dstCap) {
+    if (avail < HUFF_BLOCK_HEADER) throw std::runtime_error("huffzip: truncated block header");
+    uint32_t n = getU32(src);
+    uint32_t payload = getU32(src + 4);
+    int mode = src[8];
+    if (n > dstCap) throw std::runtime_error("huffzip: block larger than expected");
+    if ((size_t)payload > avail - HUFF_BLOCK_HEADER) throw std::runtime_error("huffzip: truncated block");
+    const unsigned char* p = src + HUFF_BLOCK_HEADER;
+
+    if (mode == HUFF_STORED) {
+        if (payload != n) throw std::runtime_error("huffzip: bad stored block");
+        memcpy(dst, p, n);
+        return HUFF_BLOCK_HEADER + payload;
+    }
+    if (mode != HUFF_CODED || payload < (uint32_t)HUFF_LEN_TABLE_BYTES)
+        throw std::runtime_error("huffzip: bad block mode");
+
+    unsigned char len[HUFF_SYMBOLS];
+    for (int i = 0; i < HUFF_LEN_TABLE_BYTES; ++i) {
+        len[2 * i] = p[i] & 15;
+        len[2 * i + 1] = p[i] >> 4;
+    }
+    if (!validCodeLengths(len)) throw std::runtime_error("huffzip: bad code lengths");
+
+    uint16_t code[HUFF_SYMBOLS];
+    buildCanonicalCodes(len, code);
+
+    //  =  << 4 | 볤δõλñ 0볤 0 Ϊ𻵣
+    std::vector<uint16_t> table((size_t)1 << HUFF_MAX_LEN, 0);
+    for (int s = 0; s < HUFF_SYMBOLS; ++s) {
+        int l = len[s];
+        if (l == 0) continue;
+        uint16_t e = (uint16_t)((s << 4) | l);
+        for (uint32_t k = code[s]; k < table.size(); k += 1u << l) table[k] = e;
+    }
+
+    const unsigned char* bits = p + HUFF_LEN_TABLE_BYTES;
+    const unsigned char* end = p + payload;
+    const uint64_t mask = ((uint64_t)1 << HUFF_MAX_LEN) - 1;
+    uint64_t acc = 0;
+    int nbits = 0;
+    int64_t consumed = 0;   // ʵõλ
+    uint32_t i = 0;
+    while (i < n) {
+        while (nbits <= 56) {
+            uint64_t b = bits < end ? *bits : 0;
+            ++bits;
+            acc |= b << nbits;
+            nbits += 8;
+        }
+        //  57 λϺ 4 
+        for (int k = 0; k < 4 && i < n; ++k) {
+            uint16_t e = table[acc & mask];
+            int l = e & 15;
+            if (l == 0) throw std::runtime_error("huffzip: corrupt code stream");
+            dst[i++] = (unsigned char)(e >> 4);
+            acc >>= l;
+            nbits -= l;
+            consumed += l;
+        }
+    }
+    if (consumed > 8 * (int64_t)(payload - HUFF_LEN_TABLE_BYTES))
+        throw std::runtime_error("huffzip: code stream overrun");
+    return HUFF_BLOCK_HEADER + payload;
+}
+
+/*====================================================
+    ѹ / ѹ鲢У
+    뵽ԼĻٰ˳ƴӲд
+    ѹʱѸָͬ߳
+====================================================*/
+inline void huffWriteFileHeader(unsigned char* out, int blockLog, uint64_t rawSize) {
+    memcpy(out, "HUFZ", 4);
+    out[4] = HUFF_VERSION;
+    out[5] = (unsigned char)blockLog;
+    out[6] = out[7] = 0;
+    putU64(out + 8, rawSize);
+}
+
+inline void huffCompress(const unsigned char* src, size_t n, int blockLog,
+                         std::vector<unsigned char>& out, MySTL::ThreadPool* pool = nullptr) {
+    if (blockLog < 12 || blockLog > 30) throw std::invalid_argument("huffzip: block size out of range");
+    size_t blockSize = (size_t)1 << blockLog;
+    size_t blocks = (n + blockSize - 1) / blockSize;
+    int threads = pool ? pool->size() : 1;
+
+    // ÿ߳һݴ갴ʵʴС黺
+    std::vector<std::vector<unsigned char> > scratch(threads);
+    std::vector<std::vector<unsigned char> > packed(blocks);
+    auto encodeRange = [&](size_t b0, size_t b1, int tid) {
+        std::vector<unsigned char>& tmp = scratch[tid];
+        for (size_t b = b0; b < b1; ++b) {
+            size_t off = b * blockSize;
+            uint32_t len = (uint32_t)std::min(blockSize, n - off);
+            if (tmp.size() < huffBlockBound(len)) tmp.resize(huffBlockBound(len));
+            size_t sz = huffEncodeBlock(src + off, len, &tmp[0]);
+            packed[b].assign(tmp.begin(), tmp.begin() + sz);
+        }
+    };
+    if (pool) pool->parallelFor(blocks, 1, encodeRange);
+    else encodeRange(0, blocks, 0);
+
+    // ˳дǰ׺Ͷλ飬ٲп
+    std::vector<uint64_t> offset(blocks);
+    size_t pos = HUFF_FILE_HEADER;
+    for (size_t b = 0; b < blocks; ++b) {
+        offset[b] = pos;
+        pos += packed[b].size();
+    }
+    size_t indexPos = pos;
+    out.resize(indexPos + blocks * 8 + HUFF_INDEX_TRAILER);
+    huffWriteFileHeader(&out[0], blockLog, n);
+    auto copyRange = [&](size_t b0, size_t b1, int) {
+        for (size_t b = b0; b < b1; ++b) {
+            memcpy(&out[(size_t)offset[b]], &packed[b][0], packed[b].size());
+            std::vector<unsigned char>().swap(packed[b]);
+        }
+    };
+    if (pool) pool->parallelFor(blocks, 4, copyRange);
+    else copyRange(0, blocks, 0);
+
+    unsigned char* p = &out[indexPos];
+    for (size_t b = 0; b < blocks; ++b, p += 8) putU64(p, offset[b]);
+    putU64(p, indexPos);
+    memcpy(p + 8, "HIDX", 4);
+}
+
+// ȡļеƫƣv2 βv1 ˳ɨͷ
+inline void huffReadBlockIndex(const unsigned char* src, size_t n, size_t blocks,
+                               std::vector<uint64_t>& offset) {
+    offset.resize(blocks);
+    if (src[4] >= 2) {
+        if (n < HUFF_FILE_HEADER + (size_t)HUFF_INDEX_TRAILER || memcmp(src + n - 4, "HIDX", 4) != 0)
+            throw std::runtime_error("huffzip: missing block index");
+        uint64_t indexPos = getU64(src + n - HUFF_INDEX_TRAILER);
+        if (indexPos < HUFF_FILE_HEADER || indexPos > n - HUFF_INDEX_TRAILER
+            || (n - HUFF_INDEX_TRAILER - indexPos) != blocks * 8)
+            throw std::runtime_error("huffzip: bad block index");
+        for (size_t b = 0; b < blocks; ++b) {
+            offset[b] = getU64(src + indexPos + 8 * b);
+            if (offset[b] >= indexPos) throw std::runtime_error("huffzip: bad block offset");
+        }
+        return;
+    }
+    size_t pos = HUFF_FILE_HEADER;
+    for (size_t b = 0; b < blocks; ++b) {
+        if (n - pos < (size_t)HUFF_BLOCK_HEADER) throw std::runtime_error("huffzip: truncated block header");
+        offset[b] = pos;
+        pos += HUFF_BLOCK_HEADER + getU32(src + pos + 4);
+        if (pos > n) throw std::runtime_error("huffzip: truncated block");
+    }
+}
+
+inline void huffDecompress(const unsigned char* src, size_t n, std::vector<unsigned char>& out,
+                           MySTL::ThreadPool* pool = nullptr) {
+    if (n < (size_t)HUFF_FILE_HEADER || memcmp(src, "HUFZ", 4) != 0)
+        throw std::runtime_error("huffzip: not a huffzip file");
+    if (src[4] < 1 || src[4] > HUFF_VERSION) throw std::runtime_error("huffzip: unsupported version");
+    int blockLog = src[5];
+    if (blockLog < 12 || blockLog > 30) throw std::runtime_error("huffzip: bad block size");
+    uint64_t rawSize = getU64(src + 8);
+    size_t blockSize = (size_t)1 << blockLog;
+    // ǰļȺ˶ rawSizeÿֽռ 1 λ
+    // ÿһͷó󣬲ܻƵļӷ
+    uint64_t blocks64 = rawSize / blockSize + (rawSize % blockSize != 0);
+    size_t body = n - HUFF_FILE_HEADER;
+    if (rawSize > (uint64_t)(size_t)-1 || rawSize / 8 > body || blocks64 > body / HUFF_BLOCK_HEADER)
+        throw std::runtime_error("huffzip: raw size does not match file length");
+    size_t blocks = (size_t)blocks64;
+
+    std::vector<uint64_t> offset;
+    huffReadBlockIndex(src, n, blocks, offset);
+    size_t limit = src[4] >= 2 ? n - HUFF_INDEX_TRAILER - blocks * 8 : n;
+
+    out.resize((size_t)rawSize);
+    auto decodeRange = [&](size_t b0, size_t b1, int) {
+        for (size_t b = b0; b < b1; ++b) {
+            size_t pos = (size_t)offset[b];
+            size_t off = b * blockSize;
+            uint32_t expect = (uint32_t)std::min((uint64_t)blockSize, rawSize - off);
+            if (limit - pos >= 4 && getU32(src + pos) != expect)
+                throw std::runtime_error("huffzip: block size mismatch");
+            huffDecodeBlock(src + pos, limit - pos, &out[off], expect);
+        }
+    };
+    if (pool) pool->parallelFor(blocks, 1, decodeRange);
+    else decodeRange(0, blocks, 0);
+}
+
+#endif
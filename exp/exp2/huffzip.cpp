@@ -0,0 +1,180 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include "huffman_codec.h"
+#include "../../MySTL/mapped_file.h"
+
+using namespace std;
+
+/*====================================================
+    huffzipֽڼ Huffman ѹ
+      huffzip c <> <> [-b СKB] [-t ߳]   ѹ
+      huffzip d <> <> [-t ߳]                 ѹ
+      huffzip b <ļ...>                                 ѹ
+      huffzip s <ļ>                                    1~16 ߳չԲ
+====================================================*/
+
+static void usage() {
+    cerr << "÷:" << endl
+         << "  huffzip c <> <> [-b СKB] [-t ߳]" << endl
+         << "  huffzip d <> <> [-t ߳]" << endl
+         << "  huffzip b <ļ...>" << endl
+         << "  huffzip s <ļ>" << endl;
+}
+
+static bool writeFile(const string& path, const vector<unsigned char>& buf) {
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) return false;
+    size_t w = buf.empty() ? 0 : fwrite(&buf[0], 1, buf.size(), f);
+    bool ok = (w == buf.size());
+    if (fclose(f) != 0) ok = false;
+    return ok;
+}
+
+// СKB log2 ֽ 2 
+static int blockLogFromKB(long kb) {
+    if (kb <= 0 || (kb & (kb - 1)) != 0) return -1;
+    int lg = 10;
+    while ((1L << (lg - 10)) < kb) lg++;
+    return lg;
+}
+
+static double secondsSince(chrono::steady_clock::time_point t0) {
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+struct BenchResult {
+    size_t packedSize;
+    double compressMBs;
+    double decompressMBs;
+    bool ok;
+};
+
+static BenchResult benchBuffer(const unsigned char* src, size_t n, int blockLog, MySTL::ThreadPool& pool) {
+    // СļظΣ֤ʱȶ
+    int rounds = n == 0 ? 1 : (int)max((size_t)1, ((size_t)64 << 20) / n);
+    rounds = min(rounds, 50);
+
+    vector<unsigned char> packed, unpacked;
+    auto t0 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) huffCompress(src, n, blockLog, packed, &pool);
+    double tc = secondsSince(t0) / rounds;
+
+    t0 = chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) huffDecompress(&packed[0], packed.size(), unpacked, &pool);
+    double td = secondsSince(t0) / rounds;
+
+    BenchResult res;
+    double mb = n / 1048576.0;
+    res.packedSize = packed.size();
+    res.compressMBs = tc > 0 ? mb / tc : 0.0;
+    res.decompressMBs = td > 0 ? mb / td : 0.0;
+    res.ok = unpacked.size() == n && (n == 0 || memcmp(&unpacked[0], src, n) == 0);
+    return res;
+}
+
+static int benchFile(const string& path, int blockLog, MySTL::ThreadPool& pool) {
+    MySTL::MappedFile in;
+    if (!in.open(path)) {
+        cerr << "޷ļ: " << path << endl;
+        return 1;
+    }
+    size_t n = in.size();
+    BenchResult r = benchBuffer(in.data(), n, blockLog, pool);
+    printf("%-28s %12zu -> %12zu  ѹ %6.3f  ѹ %8.1f MB/s  ѹ %8.1f MB/s  %s\n",
+           path.c_str(), n, r.packedSize,
+           n ? (double)r.packedSize / n : 0.0,
+           r.compressMBs, r.decompressMBs,
+           r.ok ? "OK" : "Уʧ");
+    return r.ok ? 0 : 1;
+}
+
+// ͬһļ 1~16 ߳µ
+static int scaleFile(const string& path, int blockLog) {
+    MySTL::MappedFile in;
+    if (!in.open(path)) {
+        cerr << "޷ļ: " << path << endl;
+        return 1;
+    }
+    printf("%s  %zu ֽ  С %d KB  Ӳ߳ %u\n", path.c_str(), in.size(),
+           1 << (blockLog - 10), thread::hardware_concurrency());
+    int fails = 0;
+    double base = 0;
+    for (int t = 1; t <= 16; t *= 2) {
+        MySTL::ThreadPool pool(t);
+        BenchResult r = benchBuffer(in.data(), in.size(), blockLog, pool);
+        if (t == 1) base = r.compressMBs;
+        printf("߳ %2d  ѹ %8.1f MB/s (x%.2f)  ѹ %8.1f MB/s  %s\n",
+               t, r.compressMBs, base > 0 ? r.compressMBs / base : 0.0,
+               r.decompressMBs, r.ok ? "OK" : "Уʧ");
+        if (!r.ok) fails++;
+    }
+    return fails ? 1 : 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        usage();
+        return 1;
+    }
+    string cmd = argv[1];
+    int blockLog = 20;   // Ĭ 1MB һ
+    int threads = 0;     // 0 ʾȡӲ߳
+
+    vector<string> args;
+    for (int i = 2; i < argc; ++i) {
+        if (strcmp(argv[i], "-b") == 0 && i + 1 < argc) {
+            blockLog = blockLogFromKB(atol(argv[++i]));
+            if (blockLog < 12 || blockLog > 30) {
+                cerr << "С 4KB~1GB ֮ 2 " << endl;
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+        } else {
+            args.push_back(argv[i]);
+        }
+    }
+
+    try {
+        if (cmd == "s" && args.size() == 1) return scaleFile(args[0], blockLog);
+
+        MySTL::ThreadPool pool(threads);
+        if (cmd == "b") {
+            int fails = 0;
+            for (size_t i = 0; i < args.size(); ++i) fails += benchFile(args[i], blockLog, pool);
+            return fails ? 1 : 0;
+        }
+        if ((cmd != "c" && cmd != "d") || args.size() != 2) {
+            usage();
+            return 1;
+        }
+
+        MySTL::MappedFile in;
+        if (!in.open(args[0])) {
+            cerr << "޷ļ: " << args[0] << endl;
+            return 1;
+        }
+        vector<unsigned char> out;
+        if (cmd == "c")
+            huffCompress(in.data(), in.size(), blockLog, out, &pool);
+        else
+            huffDecompress(in.data(), in.size(), out, &pool);
+
+        if (!writeFile(args[1], out)) {
+            cerr << "дʧ: " << args[1] << endl;
+            return 1;
+        }
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
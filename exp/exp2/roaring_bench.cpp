@@ -0,0 +1,125 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "../../MySTL/roaring.h"
+
+using namespace std;
+
+/*====================================================
+    ѹλͼ vs λͼڴ벢/ٶ
+    룺g++ -O2 -mavx2 -mpopcnt -mbmi2 roaring_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+struct Dataset {
+    const char* name;
+    vector<uint32_t> a, b;
+};
+
+static void runCase(const Dataset& d) {
+    uint32_t maxv = 0;
+    for (size_t i = 0; i < d.a.size(); ++i) maxv = max(maxv, d.a[i]);
+    for (size_t i = 0; i < d.b.size(); ++i) maxv = max(maxv, d.b[i]);
+    size_t universe = (size_t)maxv + 1;
+
+    MySTL::RoaringBitmap ra, rb;
+    MySTL::Bitmap da(universe), db(universe);
+    double tr = timeMs([&] {
+        ra.addMany(&d.a[0], d.a.size());
+        rb.addMany(&d.b[0], d.b.size());
+        ra.runOptimize();
+        rb.runOptimize();
+    });
+    double td = timeMs([&] {
+        for (size_t i = 0; i < d.a.size(); ++i) da.set(d.a[i]);
+        for (size_t i = 0; i < d.b.size(); ++i) db.set(d.b[i]);
+    });
+
+    MySTL::RoaringBitmap ru, ri;
+    MySTL::Bitmap du = da, di = da;
+    double tru = timeMs([&] { ru = ra | rb; });
+    double tri = timeMs([&] { ri = ra & rb; });
+    double tdu = timeMs([&] { du |= db; });
+    double tdi = timeMs([&] { di &= db; });
+
+    uint64_t sr = 0, sd = 0;
+    double tit = timeMs([&] { ru.forEach([&](uint32_t x) { sr += x; }); });
+    double tdit = timeMs([&] { du.forEach([&](size_t x) { sd += x; }); });
+
+    vector<unsigned char> buf;
+    MySTL::RoaringBitmap back;
+    double tser = timeMs([&] { ru.serialize(buf); });
+    double tde = timeMs([&] { back.deserialize(&buf[0], buf.size()); });
+
+    // λͼ
+    bool pointOK = true;
+    for (size_t i = 0; i < 1000 && i < d.a.size(); ++i) {
+        uint32_t x = d.a[i] ^ 1;
+        if (ra.contains(x) != (x < universe && da.test(x))) pointOK = false;
+    }
+    MySTL::RoaringBitmap single;
+    vector<uint32_t> removed;
+    for (size_t i = 0; i < 100000 && i < d.a.size(); ++i) single.add(d.a[i]);
+    for (size_t i = 0; i < 100000 && i < d.a.size(); i += 2) {
+        single.remove(d.a[i]);
+        removed.push_back(d.a[i]);
+    }
+    sort(removed.begin(), removed.end());
+    for (size_t i = 1; i < 100000 && i < d.a.size(); i += 2)
+        if (single.contains(d.a[i]) == binary_search(removed.begin(), removed.end(), d.a[i])) pointOK = false;
+
+    bool ok = pointOK && ru.cardinality() == du.count() && ri.cardinality() == di.count() && sr == sd && back == ru;
+
+    printf("\n--- %s: |A| = %zu, |B| = %zu, ֵ %zu ---\n", d.name, d.a.size(), d.b.size(), universe);
+    printf("ڴ      ѹ %10.2f MB (A:  %zu / λͼ %zu /  %zu ) |  %10.2f MB\n",
+           (ra.memoryBytes() + rb.memoryBytes()) / 1048576.0,
+           ra.containerCount(MySTL::RoaringBitmap::ARRAY), ra.containerCount(MySTL::RoaringBitmap::BITSET),
+           ra.containerCount(MySTL::RoaringBitmap::RUN),
+           2.0 * da.wordCount() * 8 / 1048576.0);
+    printf("      ѹ %10.3f ms |  %10.3f ms\n", tr, td);
+    printf("      ѹ %10.3f ms |  %10.3f ms |  %llu\n", tru, tdu, (unsigned long long)ru.cardinality());
+    printf("      ѹ %10.3f ms |  %10.3f ms |  %llu\n", tri, tdi, (unsigned long long)ri.cardinality());
+    printf("  ѹ %10.3f ms |  %10.3f ms\n", tit, tdit);
+    printf("л    %zu ֽ, д %.3f ms,  %.3f ms | %s\n", buf.size(), tser, tde, ok ? "OK" : "һ");
+}
+
+int main() {
+    mt19937 rng(2025);
+    cout << "==== ѹλͼܲ ====" << endl;
+
+    // ϡ裺 32 λռȡ 100 
+    Dataset sparse;
+    sparse.name = "ϡ";
+    for (int i = 0; i < 1000000; ++i) sparse.a.push_back(rng());
+    for (int i = 0; i < 1000000; ++i) sparse.b.push_back(rng());
+    runCase(sparse);
+
+    // ɶΣɶ ID
+    Dataset runs;
+    runs.name = "";
+    for (int k = 0; k < 200; ++k) {
+        uint32_t s = rng() % (1u << 31);
+        for (uint32_t v = 0; v < 50000; ++v) runs.a.push_back(s + v);
+        s = rng() % (1u << 31);
+        for (uint32_t v = 0; v < 50000; ++v) runs.b.push_back(s + v);
+    }
+    runCase(runs);
+
+    // ܣ2^26 Χȡ 1000 
+    Dataset dense;
+    dense.name = "";
+    for (int i = 0; i < 10000000; ++i) dense.a.push_back(rng() % (1u << 26));
+    for (int i = 0; i < 10000000; ++i) dense.b.push_back(rng() % (1u << 26));
+    runCase(dense);
+    return 0;
+}
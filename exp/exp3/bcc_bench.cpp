@@ -0,0 +1,140 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "biconnected.h"
+
+using namespace std;
+
+/*====================================================
+    ˫ͨ /  / Ų
+    1. Сͼ뱩ɾ㡢ɾ߽˶ԣرߡԻ
+    2. 10^7 ĳݹ DFS Ȼջ
+    3. 10^7 ߵͼ֦
+    룺g++ -O2 -pthread bcc_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// ȥ skipV skipE ߺͨҲ㣩
+static int countComponents(int V, const vector<GraphEdge>& edges, int skipV, int skipE) {
+    vector<int> p(V);
+    for (int i = 0; i < V; ++i) p[i] = i;
+    struct F {
+        static int find(vector<int>& p, int x) {
+            while (p[x] != x) x = p[x] = p[p[x]];
+            return x;
+        }
+    };
+    int comps = V - (skipV >= 0 ? 1 : 0);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        if ((int)i == skipE || edges[i].u == skipV || edges[i].v == skipV) continue;
+        int a = F::find(p, edges[i].u), b = F::find(p, edges[i].v);
+        if (a != b) {
+            p[a] = b;
+            comps--;
+        }
+    }
+    return comps;
+}
+
+static bool bruteCheck(unsigned seed) {
+    mt19937 rng(seed);
+    const int V = 200;
+    vector<GraphEdge> edges;
+    // СټߡرߺԻ
+    for (int v = 1; v < V; ++v) {
+        GraphEdge e = {(int)(v - 1 - rng() % min(v, 3)), v, 1};
+        edges.push_back(e);
+    }
+    for (int i = 0; i < 30; ++i) {
+        int u = (int)(rng() % V);
+        GraphEdge e = {u, (int)(u + rng() % 8) % V, 1};
+        edges.push_back(e);
+    }
+    edges.push_back(edges[5]);     // ر
+    CSRGraph g(V, edges);
+    BiconnectedComponents bcc(g);
+
+    int base = countComponents(V, edges, -1, -1);
+    vector<int> cut;
+    for (int v = 0; v < V; ++v)
+        if (countComponents(V, edges, v, -1) > base) cut.push_back(v);
+    set<pair<int, int> > br;
+    for (size_t i = 0; i < edges.size(); ++i)
+        if (edges[i].u != edges[i].v && countComponents(V, edges, -1, (int)i) > base)
+            br.insert(make_pair(min(edges[i].u, edges[i].v), max(edges[i].u, edges[i].v)));
+
+    set<pair<int, int> > got;
+    for (size_t i = 0; i < bcc.bridges.size(); ++i)
+        got.insert(make_pair(min(bcc.bridges[i].first, bcc.bridges[i].second),
+                             max(bcc.bridges[i].first, bcc.bridges[i].second)));
+
+    // ÿԻǡóһԳһ
+    size_t nonLoop = 0, inComp = bcc.compU.size();
+    for (size_t i = 0; i < edges.size(); ++i) nonLoop += edges[i].u != edges[i].v;
+    size_t singles = 0;
+    for (int c = 0; c < bcc.componentCount(); ++c)
+        singles += bcc.compOffsets[c + 1] - bcc.compOffsets[c] == 1;
+    return cut == bcc.articulationPoints && br == got && nonLoop == inComp && singles >= br.size();
+}
+
+int main() {
+    cout << "==== ˫ͨ ====" << endl;
+    int fails = 0;
+    for (unsigned s = 1; s <= 20; ++s) fails += !bruteCheck(s);
+    printf("20 Сͼ뱩˶ԣ%s\n", fails ? "һ" : "OK");
+
+    // 
+    {
+        const int V = 10000000;
+        vector<GraphEdge> edges(V - 1);
+        for (int v = 1; v < V; ++v) {
+            edges[v - 1].u = v - 1;
+            edges[v - 1].v = v;
+            edges[v - 1].w = 1;
+        }
+        CSRGraph g(V, edges);
+        BiconnectedComponents bcc;
+        double t = timeMs([&] { bcc.run(g); });
+        bool ok = (int)bcc.articulationPoints.size() == V - 2 && (int)bcc.bridges.size() == V - 1 &&
+                  bcc.componentCount() == V - 1;
+        printf(" V = %d  %8.1f ms   %zu   %zu   %d  %s\n", V, t,
+               bcc.articulationPoints.size(), bcc.bridges.size(), bcc.componentCount(), ok ? "OK" : "һ");
+    }
+
+    // ͼ + ֦
+    {
+        const int core = 1000000, hang = 200000;
+        const int V = core + hang;
+        mt19937_64 rng(3);
+        vector<GraphEdge> edges;
+        edges.reserve(10000000);
+        while (edges.size() < 10000000 - (size_t)hang) {
+            GraphEdge e = {(int)(rng() % core), (int)(rng() % core), 1};
+            if (e.u != e.v) edges.push_back(e);
+        }
+        for (int v = core; v < V; ++v) {
+            GraphEdge e = {(int)(rng() % v), v, 1};
+            edges.push_back(e);
+        }
+        CSRGraph g(V, edges);
+        BiconnectedComponents bcc;
+        double t = timeMs([&] { bcc.run(g); });
+        size_t biggest = 0;
+        for (int c = 0; c < bcc.componentCount(); ++c)
+            biggest = max(biggest, (size_t)(bcc.compOffsets[c + 1] - bcc.compOffsets[c]));
+        printf("ͼ V = %d  E = %zu  %8.1f ms   %zu   %zu   %d   %zu \n", V,
+               edges.size(), t, bcc.articulationPoints.size(), bcc.bridges.size(), bcc.componentCount(), biggest);
+    }
+    return fails ? 1 : 0;
+}
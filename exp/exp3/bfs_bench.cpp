@@ -0,0 +1,135 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+#include "parallel_bfs.h"
+
+using namespace std;
+
+/*====================================================
+    BFS ԣGraph500 ʽ RMAT ͼa/b/c/d = 0.57/0.19/0.19/0.05
+    ƽÿ 16 ߣ
+         : CSRGraph::BFS
+      Զ : ParallelBFSalpha = 0
+      Ż : ParallelBFSĬ alpha = 15, beta = 18
+    TEPS = Դͨ / ʱԴȡƽ
+    ÷bfs_bench [С scale] [ scale] [߳]Ĭ 20 22
+    룺g++ -O2 -pthread bfs_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeSec(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+//  RMAT ߱ÿöӣ߳޹
+static vector<GraphEdge> rmat(int scale, size_t m, MySTL::ThreadPool& pool) {
+    vector<GraphEdge> edges(m);
+    const size_t block = 1 << 16;
+    pool.parallelFor(m, block, [&](size_t b, size_t e, int) {
+        mt19937_64 rng(b / block * 2654435761ULL + scale);
+        uniform_real_distribution<double> uni(0.0, 1.0);
+        for (size_t i = b; i < e; ++i) {
+            int u = 0, v = 0;
+            for (int bit = 0; bit < scale; ++bit) {
+                double r = uni(rng);
+                if (r < 0.57) continue;
+                if (r < 0.76) v |= 1 << bit;
+                else if (r < 0.95) u |= 1 << bit;
+                else { u |= 1 << bit; v |= 1 << bit; }
+            }
+            edges[i].u = u;
+            edges[i].v = v;
+            edges[i].w = 1;
+        }
+    });
+    return edges;
+}
+
+// вղ
+static vector<int> serialLevels(const CSRGraph& g, int s) {
+    vector<int> level(g.V, -1);
+    vector<int> order = g.BFS(s);
+    level[s] = 0;
+    for (size_t i = 0; i < order.size(); ++i) {
+        int u = order[i];
+        for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k)
+            if (level[g.adj[k]] < 0) level[g.adj[k]] = level[u] + 1;
+    }
+    return level;
+}
+
+// ھҲǡСһ
+static bool validParents(const CSRGraph& g, const ParallelBFS& bfs, int s) {
+    const vector<int>& p = bfs.parents();
+    const vector<int>& lv = bfs.levels();
+    for (int v = 0; v < g.V; ++v) {
+        if (lv[v] < 0 || v == s) continue;
+        if (p[v] < 0 || lv[p[v]] != lv[v] - 1 || !g.hasEdge(p[v], v)) return false;
+    }
+    return p[s] == s;
+}
+
+int main(int argc, char* argv[]) {
+    int lo = argc > 1 ? atoi(argv[1]) : 20;
+    int hi = argc > 2 ? atoi(argv[2]) : 22;
+    int threads = argc > 3 ? atoi(argv[3]) : 0;
+    MySTL::ThreadPool pool(threads);
+    printf("==== Ż BFS ԣ%d ̣߳Ӳ߳ %u====\n", pool.size(), thread::hardware_concurrency());
+
+    for (int scale = lo; scale <= hi; ++scale) {
+        int V = 1 << scale;
+        size_t m = (size_t)16 << scale;
+        CSRGraph g;
+        double tg = timeSec([&] {
+            vector<GraphEdge> edges = rmat(scale, m, pool);
+            g = CSRGraph(V, edges, true, &pool);
+        });
+        printf("\nscale %d  V = %d   %zu   + ͼ %.1f s\n", scale, V, m, tg);
+
+        mt19937 rng(scale);
+        vector<int> sources;
+        while (sources.size() < 8) {
+            int s = (int)(rng() % V);
+            if (g.degree(s) > 0) sources.push_back(s);
+        }
+
+        ParallelBFS topDown(g, &pool, 0), dirOpt(g, &pool);
+        double inv[3] = {0, 0, 0};
+        bool ok = true;
+        int steps[2] = {0, 0};
+        for (size_t i = 0; i < sources.size(); ++i) {
+            int s = sources[i];
+            double t0 = timeSec([&] { g.BFS(s); });
+            vector<int> ref = serialLevels(g, s);
+            uint64_t arcs = 0;
+            for (int v = 0; v < V; ++v)
+                if (ref[v] >= 0) arcs += g.degree(v);
+            double edges = arcs / 2.0;
+
+            double t1 = timeSec([&] { topDown.run(s); });
+            double t2 = timeSec([&] { dirOpt.run(s); });
+            ok = ok && topDown.levels() == ref && dirOpt.levels() == ref;
+            ok = ok && validParents(g, topDown, s) && validParents(g, dirOpt, s);
+            inv[0] += t0 / edges;
+            inv[1] += t1 / edges;
+            inv[2] += t2 / edges;
+            steps[0] += dirOpt.topDownCount();
+            steps[1] += dirOpt.bottomUpCount();
+        }
+        int n = (int)sources.size();
+        printf("       %8.1f MTEPS\n", n / inv[0] / 1e6);
+        printf("  Զ %8.1f MTEPS\n", n / inv[1] / 1e6);
+        printf("  Ż %8.1f MTEPSx%.1fƽ %d Զ + %d Եϣ  %s\n",
+               n / inv[2] / 1e6, inv[1] / inv[2], steps[0] / n, steps[1] / n, ok ? "OK" : "һ");
+    }
+    return 0;
+}
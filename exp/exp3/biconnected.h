@@ -0,0 +1,119 @@
+#ifndef BICONNECTED_H
+#define BICONNECTED_H
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.h"
+
+/*====================================================
+    ˫ͨ /  / ţHopcroftCTarjanͼ
+    - ʽջģ DFSȵҲᱬջ
+    - ߺָȵĻرѹջӽ c ʱ
+       low[c] >= disc[u] (u, c) Ϊֹһ
+    - رߣֻһͨ򸸽Ļఴرߴ
+      ƽб߲ᱻгţԻ
+    ڱƽ c ıΪ
+      [compOffsets[c], compOffsets[c+1]) Χڵ (compU, compV)
+====================================================*/
+class BiconnectedComponents {
+public:
+    std::vector<int> articulationPoints;              // 
+    std::vector<std::pair<int, int> > bridges;        // (, )
+    std::vector<uint64_t> compOffsets;                //  + 1 
+    std::vector<int> compU, compV;
+
+    BiconnectedComponents() {}
+
+    explicit BiconnectedComponents(const CSRGraph& g) {
+        run(g);
+    }
+
+    int componentCount() const {
+        return (int)compOffsets.size() - 1;
+    }
+
+    //  c 漰Ķ㣨ȥأ
+    std::vector<int> componentVertices(int c) const {
+        std::vector<int> vs;
+        for (uint64_t k = compOffsets[c]; k < compOffsets[c + 1]; ++k) {
+            vs.push_back(compU[k]);
+            vs.push_back(compV[k]);
+        }
+        std::sort(vs.begin(), vs.end());
+        vs.erase(std::unique(vs.begin(), vs.end()), vs.end());
+        return vs;
+    }
+
+    void run(const CSRGraph& g) {
+        int V = g.V;
+        articulationPoints.clear();
+        bridges.clear();
+        compOffsets.assign(1, 0);
+        compU.clear();
+        compV.clear();
+
+        std::vector<int> disc(V, -1), low(V, 0), parent(V, -1), children(V, 0);
+        std::vector<uint64_t> next(V);
+        std::vector<char> skipped(V, 0), isCut(V, 0);
+        std::vector<int> call;                   // DFS ·
+        std::vector<int> stU, stV;               // ջ
+        int time = 0;
+
+        for (int root = 0; root < V; ++root) {
+            if (disc[root] != -1) continue;
+            disc[root] = low[root] = time++;
+            next[root] = g.offsets[root];
+            call.push_back(root);
+            while (!call.empty()) {
+                int u = call.back();
+                if (next[u] < g.offsets[u + 1]) {
+                    int w = g.adj[next[u]++];
+                    if (w == u) continue;
+                    if (w == parent[u] && !skipped[u]) {
+                        skipped[u] = 1;
+                        continue;
+                    }
+                    if (disc[w] == -1) {
+                        stU.push_back(u);
+                        stV.push_back(w);
+                        parent[w] = u;
+                        children[u]++;
+                        disc[w] = low[w] = time++;
+                        next[w] = g.offsets[w];
+                        call.push_back(w);
+                    } else if (disc[w] < disc[u]) {
+                        stU.push_back(u);
+                        stV.push_back(w);
+                        low[u] = std::min(low[u], disc[w]);
+                    }
+                    continue;
+                }
+
+                // u ھȫ꣬ص p
+                call.pop_back();
+                int p = parent[u];
+                if (p < 0) continue;
+                low[p] = std::min(low[p], low[u]);
+                if (low[u] < disc[p]) continue;
+                if (parent[p] >= 0 || children[p] >= 2) isCut[p] = 1;
+                if (low[u] > disc[p]) bridges.push_back(std::make_pair(p, u));
+                for (;;) {
+                    int a = stU.back(), b = stV.back();
+                    stU.pop_back();
+                    stV.pop_back();
+                    compU.push_back(a);
+                    compV.push_back(b);
+                    if (a == p && b == u) break;
+                }
+                compOffsets.push_back(compU.size());
+            }
+        }
+        for (int v = 0; v < V; ++v)
+            if (isCut[v]) articulationPoints.push_back(v);
+    }
+};
+
+#endif
@@ -0,0 +1,197 @@
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+#include "graph.h"
+#include "csr_graph.h"
+#include "biconnected.h"
+
+using namespace std;
+
+/*====================================================
+    ڽӾ Graph  CSRGraph Ա
+    1. СͼV = 3000߶ܣ˶ȫһ
+    2. ϡͼE = 10^610^7ֻ CSR ܣ
+       ߳̽ͼ͸㷨ʱ
+    룺g++ -O2 -pthread csr_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// ͨͼһٲߣdistinctW ʱȨͬ
+static vector<GraphEdge> randomGraph(int V, size_t E, bool distinctW, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<GraphEdge> edges;
+    edges.reserve(E);
+    set<pair<int, int> > seen;
+    for (int v = 1; v < V && edges.size() < E; ++v) {
+        GraphEdge e = {(int)(rng() % v), v, 0};
+        edges.push_back(e);
+        if (distinctW) seen.insert(make_pair(e.u, e.v));
+    }
+    while (edges.size() < E) {
+        int u = (int)(rng() % V), v = (int)(rng() % V);
+        if (u == v) continue;
+        if (distinctW && !seen.insert(make_pair(min(u, v), max(u, v))).second) continue;
+        GraphEdge e = {u, v, 0};
+        edges.push_back(e);
+    }
+    if (distinctW) {
+        vector<int> w(edges.size());
+        for (size_t i = 0; i < w.size(); ++i) w[i] = (int)i + 1;
+        shuffle(w.begin(), w.end(), rng);
+        for (size_t i = 0; i < w.size(); ++i) edges[i].w = w[i];
+    } else {
+        for (size_t i = 0; i < edges.size(); ++i) edges[i].w = (int)(rng() % 100) + 1;
+    }
+    return edges;
+}
+
+// ػ Graph Աӡ cout 
+template<typename F>
+static string capture(F fn) {
+    ostringstream os;
+    streambuf* old = cout.rdbuf(os.rdbuf());
+    fn();
+    cout.rdbuf(old);
+    return os.str();
+}
+
+static string joinOrder(const vector<int>& order) {
+    ostringstream os;
+    for (size_t i = 0; i < order.size(); ++i) os << order[i] << " ";
+    os << endl;
+    return os.str();
+}
+
+// ڡ䶼Ƚ
+static set<vector<int> > normalize(vector<vector<int> > comps) {
+    set<vector<int> > s;
+    for (size_t i = 0; i < comps.size(); ++i) {
+        sort(comps[i].begin(), comps[i].end());
+        s.insert(comps[i]);
+    }
+    return s;
+}
+
+static set<vector<int> > parseBCC(const string& text) {
+    istringstream is(text);
+    string line;
+    getline(is, line);   // 
+    vector<vector<int> > comps;
+    while (getline(is, line)) {
+        istringstream ls(line);
+        vector<int> c;
+        int x;
+        while (ls >> x) c.push_back(x);
+        comps.push_back(c);
+    }
+    return normalize(comps);
+}
+
+static void compareSmall() {
+    const int V = 3000;
+    vector<GraphEdge> edges = randomGraph(V, 30000, true, 7);
+    Graph g(V);
+    double tm = timeMs([&] {
+        for (size_t i = 0; i < edges.size(); ++i) g.addEdge(edges[i].u, edges[i].v, edges[i].w);
+    });
+    CSRGraph c;
+    double tc = timeMs([&] { c = CSRGraph(V, edges); });
+    printf("V = %d  E = %zu   ͼ:  %8.2f ms (%.1f MB)   CSR %8.2f ms (%.1f MB)\n", V, edges.size(),
+           tm, (double)V * V * sizeof(int) / 1048576.0, tc,
+           (c.offsets.size() * 8 + c.adj.size() * 8) / 1048576.0);
+
+    string a, b;
+    vector<int> order;
+    vector<long long> dist;
+    vector<int> parent;
+    vector<vector<int> > comps;
+    double m1, c1;
+
+    m1 = timeMs([&] { a = capture([&] { g.BFS(0); }); });
+    c1 = timeMs([&] { order = c.BFS(0); });
+    printf("BFS        %8.2f ms   CSR %8.2f ms   %s\n", m1, c1, a == joinOrder(order) ? "һ" : "һ");
+
+    m1 = timeMs([&] { a = capture([&] { g.DFS(0); }); });
+    c1 = timeMs([&] { order = c.DFS(0); });
+    printf("DFS        %8.2f ms   CSR %8.2f ms   %s\n", m1, c1, a == joinOrder(order) ? "һ" : "һ");
+
+    m1 = timeMs([&] { a = capture([&] { g.dijkstra(0); }); });
+    c1 = timeMs([&] { dist = c.dijkstra(0); });
+    ostringstream os;
+    for (int i = 0; i < V; ++i) os << "Distance from 0 to " << i << ": " << dist[i] << endl;
+    printf("Dijkstra   %8.2f ms   CSR %8.2f ms   %s\n", m1, c1, a == os.str() ? "һ" : "һ");
+
+    m1 = timeMs([&] { a = capture([&] { g.prim(); }); });
+    c1 = timeMs([&] { parent = c.prim(); });
+    os.str("");
+    os << "Edge \t Weight" << endl;
+    for (int i = 1; i < V; ++i) os << parent[i] << " - " << i << " \t " << g.adjMatrix[i][parent[i]] << endl;
+    printf("Prim       %8.2f ms   CSR %8.2f ms   %s\n", m1, c1, a == os.str() ? "һ" : "һ");
+
+    m1 = timeMs([&] { a = capture([&] { g.findBCC(); }); });
+    c1 = timeMs([&] {
+        BiconnectedComponents bcc(c);
+        comps.clear();
+        for (int k = 0; k < bcc.componentCount(); ++k) comps.push_back(bcc.componentVertices(k));
+    });
+    printf("˫ͨ     %8.2f ms   CSR %8.2f ms   %s\n", m1, c1,
+           parseBCC(a) == normalize(comps) ? "һ" : "һ");
+}
+
+static void sparseLarge(int V, size_t E) {
+    vector<GraphEdge> edges = randomGraph(V, E, false, 11);
+    printf("\nV = %d  E = %zuڽӾ %.1f GB\n", V, E, (double)V * V * sizeof(int) / 1073741824.0);
+
+    CSRGraph c;
+    for (int t = 1; t <= 8; t *= 2) {
+        MySTL::ThreadPool pool(t);
+        double tb = timeMs([&] { c = CSRGraph(V, edges, true, &pool); });
+        printf("  ͼ %d ߳ %8.1f ms\n", t, tb);
+    }
+
+    size_t reach = 0, comps = 0;
+    long long far = 0, mst = 0;
+    double tb = timeMs([&] { reach = c.BFS(0).size(); });
+    double td = timeMs([&] { reach += c.DFS(0).size(); });
+    double tj = timeMs([&] {
+        vector<long long> d = c.dijkstra(0);
+        for (int i = 0; i < V; ++i) if (d[i] != CSR_INF) far = max(far, d[i]);
+    });
+    double tp = timeMs([&] {
+        vector<int> p = c.prim();
+        for (int v = 0; v < V; ++v) {
+            if (p[v] < 0) continue;
+            int best = INT_MAX;
+            for (uint64_t k = c.offsets[v]; k < c.offsets[v + 1]; ++k)
+                if (c.adj[k] == p[v]) best = min(best, c.weight[k]);
+            mst += best;
+        }
+    });
+    double tc = timeMs([&] { comps = BiconnectedComponents(c).componentCount(); });
+    printf("  BFS %7.1f ms  DFS %7.1f ms  Dijkstra %7.1f ms  Prim %7.1f ms  ˫ͨ %7.1f ms\n",
+           tb, td, tj, tp, tc);
+    printf("  ɴ %zu  Զ %lld  Ȩ %lld   %zu  %s\n", reach / 2, far, mst, comps,
+           reach == 2 * (size_t)V ? "OK" : "ͨ");
+}
+
+int main() {
+    cout << "==== CSR ͼԣӲ߳ " << thread::hardware_concurrency() << "====" << endl;
+    compareSmall();
+    sparseLarge(100000, 1000000);
+    sparseLarge(1000000, 10000000);
+    return 0;
+}
@@ -0,0 +1,402 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../MySTL/mapped_file.h"
+#include "../../MySTL/thread_pool.h"
+
+// ߱еһ
+struct GraphEdge {
+    int u, v;
+    int w;
+};
+
+const long long CSR_INF = LLONG_MAX;
+
+/*----------------------------------------------------
+    CSR õ飺ƽʱԼݣstd::vector
+    Ҳָֻⲿڴ棨mmap ͼļ
+    °±ʵĴȫһ
+----------------------------------------------------*/
+template<typename T>
+class CSRArray {
+public:
+    CSRArray() : p(nullptr), n(0) {}
+
+    CSRArray(size_t count, const T& v) : own(count, v) {
+        sync();
+    }
+
+    CSRArray(const CSRArray& o) : own(o.own), p(o.p), n(o.n) {
+        if (o.owned()) sync();
+    }
+
+    CSRArray& operator=(const CSRArray& o) {
+        if (this != &o) {
+            own = o.own;
+            p = o.p;
+            n = o.n;
+            if (o.owned()) sync();
+        }
+        return *this;
+    }
+
+    // vector ƶ󻺳ַ䣬p ȻЧ
+    CSRArray(CSRArray&& o) : own(std::move(o.own)), p(o.p), n(o.n) {
+        o.p = nullptr;
+        o.n = 0;
+    }
+
+    CSRArray& operator=(CSRArray&& o) {
+        if (this != &o) {
+            own = std::move(o.own);
+            p = o.p;
+            n = o.n;
+            o.p = nullptr;
+            o.n = 0;
+        }
+        return *this;
+    }
+
+    void assign(size_t count, const T& v) {
+        own.assign(count, v);
+        sync();
+    }
+
+    void resize(size_t count) {
+        own.resize(count);
+        sync();
+    }
+
+    // ָⲿֻڴ棬÷֤
+    void attach(const T* data, size_t count) {
+        std::vector<T>().swap(own);
+        p = const_cast<T*>(data);
+        n = count;
+    }
+
+    bool owned() const {
+        return p == own.data();
+    }
+
+    size_t size() const {
+        return n;
+    }
+
+    T& operator[](size_t i) {
+        return p[i];
+    }
+
+    const T& operator[](size_t i) const {
+        return p[i];
+    }
+
+    const T* data() const {
+        return p;
+    }
+
+    const T* begin() const {
+        return p;
+    }
+
+    const T* end() const {
+        return p + n;
+    }
+
+private:
+    std::vector<T> own;
+    T* p;
+    size_t n;
+
+    void sync() {
+        p = own.data();
+        n = own.size();
+    }
+};
+
+/*====================================================
+    ͼѹϡУCSRʾ
+     u ھΪ adj[offsets[u] .. offsets[u+1])
+    ӦȨֵ weight ͬһλãÿڽӱ (ھ, Ȩֵ) 
+     BFS / DFS ķʴڽӾ汾һ
+    ռ O(V + E)㷨һֻ u ʵھ
+====================================================*/
+class CSRGraph {
+public:
+    int V;                          // 
+    CSRArray<uint64_t> offsets;     // V + 1 
+    CSRArray<int> adj;              // ھ
+    CSRArray<int> weight;           // Ȩ
+
+    CSRGraph() : V(0), offsets(1, 0) {}
+
+    /*------------------------------------------------
+        ɱ߱ͼ򣩣
+        1. ͳƳ   2. ǰ׺͵õ offsets
+        3. аԭαɢ   4. ÿڽӱ
+        undirected Ϊʱÿߴ
+    ------------------------------------------------*/
+    CSRGraph(int vertices, const std::vector<GraphEdge>& edges, bool undirected = true,
+             MySTL::ThreadPool* pool = nullptr) : V(vertices) {
+        if (vertices < 0) throw std::invalid_argument("CSRGraph: negative vertex count");
+        size_t m = edges.size();
+        const size_t grain = 1 << 16;
+        MySTL::ThreadPool single(1);
+        MySTL::ThreadPool& tp = pool ? *pool : single;
+
+        std::unique_ptr<std::atomic<uint64_t>[]> cursor(new std::atomic<uint64_t>[(size_t)V + 1]);
+        tp.parallelFor((size_t)V + 1, grain, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) cursor[i].store(0, std::memory_order_relaxed);
+        });
+        std::atomic<bool> bad(false);
+        tp.parallelFor(m, grain, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) {
+                const GraphEdge& g = edges[i];
+                if ((unsigned)g.u >= (unsigned)V || (unsigned)g.v >= (unsigned)V) {
+                    bad.store(true, std::memory_order_relaxed);
+                    continue;
+                }
+                cursor[g.u].fetch_add(1, std::memory_order_relaxed);
+                if (undirected) cursor[g.v].fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        if (bad.load()) throw std::invalid_argument("CSRGraph: vertex id out of range");
+
+        offsets.assign((size_t)V + 1, 0);
+        for (int u = 0; u < V; ++u) {
+            offsets[u + 1] = offsets[u] + cursor[u].load(std::memory_order_relaxed);
+            cursor[u].store(offsets[u], std::memory_order_relaxed);
+        }
+
+        // (ھ << 32 | ƫúȨֵ) 󼴰 (ھ, Ȩֵ) 
+        uint64_t arcs = offsets[V];
+        std::vector<uint64_t> packed(arcs);
+        tp.parallelFor(m, grain, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) {
+                const GraphEdge& g = edges[i];
+                uint64_t w = (uint32_t)g.w ^ 0x80000000u;
+                packed[cursor[g.u].fetch_add(1, std::memory_order_relaxed)] = ((uint64_t)g.v << 32) | w;
+                if (undirected)
+                    packed[cursor[g.v].fetch_add(1, std::memory_order_relaxed)] = ((uint64_t)g.u << 32) | w;
+            }
+        });
+        cursor.reset();
+
+        adj.resize(arcs);
+        weight.resize(arcs);
+        tp.parallelFor((size_t)V, grain / 16, [&](size_t b, size_t e, int) {
+            for (size_t u = b; u < e; ++u) {
+                std::sort(packed.begin() + offsets[u], packed.begin() + offsets[u + 1]);
+                for (uint64_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                    adj[k] = (int)(packed[k] >> 32);
+                    weight[k] = (int)((uint32_t)packed[k] ^ 0x80000000u);
+                }
+            }
+        });
+    }
+
+    /*------------------------------------------------
+        ͼļֽ򣬰 64 ֽڶֶΣ
+          0  "CSRG"        4  汾 1        8  ֽ 0x01020304
+          16 V (u64)       24  (u64)
+          32 offsets λ  40 adj λ      48 weight λ   56 
+        ֮Ϊ offsets[V+1] (u64)adj[] (i32)weight[] (i32)
+        attachFile ֱӰӳ飬л
+    ------------------------------------------------*/
+    void saveFile(const std::string& path) const {
+        uint64_t arcs = arcCount();
+        uint64_t hdr[8] = {0};
+        uint64_t offPos = 64;
+        uint64_t adjPos = alignUp(offPos + ((uint64_t)V + 1) * 8);
+        uint64_t wPos = alignUp(adjPos + arcs * 4);
+        std::memcpy(hdr, "CSRG", 4);
+        uint32_t ver = 1, bom = 0x01020304;
+        std::memcpy((char*)hdr + 4, &ver, 4);
+        std::memcpy((char*)hdr + 8, &bom, 4);
+        hdr[2] = (uint64_t)V;
+        hdr[3] = arcs;
+        hdr[4] = offPos;
+        hdr[5] = adjPos;
+        hdr[6] = wPos;
+
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) throw std::runtime_error("CSRGraph: cannot create " + path);
+        static const char zeros[64] = {0};
+        bool ok = fwrite(hdr, 1, 64, f) == 64;
+        ok = ok && fwrite(offsets.data(), 8, (size_t)V + 1, f) == (size_t)V + 1;
+        ok = ok && fwrite(zeros, 1, adjPos - (offPos + ((uint64_t)V + 1) * 8), f) == adjPos - (offPos + ((uint64_t)V + 1) * 8);
+        ok = ok && (arcs == 0 || fwrite(adj.data(), 4, arcs, f) == arcs);
+        ok = ok && fwrite(zeros, 1, wPos - (adjPos + arcs * 4), f) == wPos - (adjPos + arcs * 4);
+        ok = ok && (arcs == 0 || fwrite(weight.data(), 4, arcs, f) == arcs);
+        if (fclose(f) != 0) ok = false;
+        if (!ok) throw std::runtime_error("CSRGraph: write failed " + path);
+    }
+
+    // verify Ϊʱ offsets ھӱźϷO(V + E)
+    void attachFile(const std::string& path, bool verify = false) {
+        std::shared_ptr<MySTL::MappedFile> mf(new MySTL::MappedFile());
+        if (!mf->open(path, false)) throw std::runtime_error("CSRGraph: cannot open " + path);
+        const unsigned char* d = mf->data();
+        uint64_t size = mf->size();
+        uint64_t hdr[8];
+        uint32_t ver = 0, bom = 0;
+        if (size < 64 || std::memcmp(d, "CSRG", 4) != 0) throw std::runtime_error("CSRGraph: not a graph file");
+        std::memcpy(hdr, d, 64);
+        std::memcpy(&ver, d + 4, 4);
+        std::memcpy(&bom, d + 8, 4);
+        if (ver != 1 || bom != 0x01020304) throw std::runtime_error("CSRGraph: unsupported version or byte order");
+        uint64_t nv = hdr[2], arcs = hdr[3];
+        if (nv >= (uint64_t)INT_MAX || hdr[4] % 8 || hdr[5] % 4 || hdr[6] % 4 ||
+            hdr[4] + (nv + 1) * 8 > size || hdr[5] + arcs * 4 > size || hdr[6] + arcs * 4 > size)
+            throw std::runtime_error("CSRGraph: corrupt header");
+        const uint64_t* off = (const uint64_t*)(d + hdr[4]);
+        if (off[0] != 0 || off[nv] != arcs) throw std::runtime_error("CSRGraph: corrupt offsets");
+        const int* a = (const int*)(d + hdr[5]);
+        if (verify) {
+            for (uint64_t u = 0; u < nv; ++u)
+                if (off[u] > off[u + 1]) throw std::runtime_error("CSRGraph: corrupt offsets");
+            for (uint64_t k = 0; k < arcs; ++k)
+                if ((unsigned)a[k] >= (unsigned)nv) throw std::runtime_error("CSRGraph: corrupt adjacency");
+        }
+        V = (int)nv;
+        offsets.attach(off, nv + 1);
+        adj.attach(a, arcs);
+        weight.attach((const int*)(d + hdr[6]), arcs);
+        mapping = mf;
+    }
+
+    // Ƿӳļ
+    bool isMapped() const {
+        return mapping != nullptr;
+    }
+
+    int vertexCount() const {
+        return V;
+    }
+
+    // ͼÿ߼Σ
+    uint64_t arcCount() const {
+        return offsets[V];
+    }
+
+    int degree(int u) const {
+        return (int)(offsets[u + 1] - offsets[u]);
+    }
+
+    // ڽӱ򣬿ɶжϱǷ
+    bool hasEdge(int u, int v) const {
+        return std::binary_search(adj.begin() + offsets[u], adj.begin() + offsets[u + 1], v);
+    }
+
+    // طʴ
+    std::vector<int> BFS(int start) const {
+        std::vector<int> order;
+        std::vector<bool> visited(V, false);
+        order.reserve(V);
+        visited[start] = true;
+        order.push_back(start);
+        for (size_t head = 0; head < order.size(); ++head) {
+            int node = order[head];
+            for (uint64_t k = offsets[node]; k < offsets[node + 1]; ++k) {
+                int v = adj[k];
+                if (!visited[v]) {
+                    visited[v] = true;
+                    order.push_back(v);
+                }
+            }
+        }
+        return order;
+    }
+
+    // ջʱʣ汾ѹջͬ
+    std::vector<int> DFS(int start) const {
+        std::vector<int> order;
+        std::vector<bool> visited(V, false);
+        std::vector<int> s;
+        s.push_back(start);
+        while (!s.empty()) {
+            int node = s.back();
+            s.pop_back();
+            if (visited[node]) continue;
+            visited[node] = true;
+            order.push_back(node);
+            for (uint64_t k = offsets[node]; k < offsets[node + 1]; ++k)
+                if (!visited[adj[k]]) s.push_back(adj[k]);
+        }
+        return order;
+    }
+
+    // DijkstraѣʱɴΪ CSR_INF
+    std::vector<long long> dijkstra(int start) const {
+        typedef std::pair<long long, int> Item;
+        std::vector<long long> dist(V, CSR_INF);
+        std::priority_queue<Item, std::vector<Item>, std::greater<Item> > pq;
+        dist[start] = 0;
+        pq.push(Item(0, start));
+        while (!pq.empty()) {
+            Item top = pq.top();
+            pq.pop();
+            int u = top.second;
+            if (top.first != dist[u]) continue;
+            for (uint64_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                long long nd = top.first + weight[k];
+                if (nd < dist[adj[k]]) {
+                    dist[adj[k]] = nd;
+                    pq.push(Item(nd, adj[k]));
+                }
+            }
+        }
+        return dist;
+    }
+
+    // Prim С parentÿͨĸΪ -1
+    std::vector<int> prim() const {
+        typedef std::pair<int, int> Item;   // (key, )
+        std::vector<int> parent(V, -1);
+        std::vector<int> key(V, INT_MAX);
+        std::vector<bool> inMST(V, false);
+        std::priority_queue<Item, std::vector<Item>, std::greater<Item> > pq;
+        for (int r = 0; r < V; ++r) {
+            if (inMST[r]) continue;
+            key[r] = 0;
+            pq.push(Item(0, r));
+            while (!pq.empty()) {
+                int u = pq.top().second;
+                pq.pop();
+                if (inMST[u]) continue;
+                inMST[u] = true;
+                for (uint64_t k = offsets[u]; k < offsets[u + 1]; ++k) {
+                    int v = adj[k];
+                    if (!inMST[v] && weight[k] < key[v]) {
+                        key[v] = weight[k];
+                        parent[v] = u;
+                        pq.push(Item(key[v], v));
+                    }
+                }
+            }
+        }
+        return parent;
+    }
+
+private:
+    std::shared_ptr<MySTL::MappedFile> mapping;   // ӳͼļһͷ
+
+    static uint64_t alignUp(uint64_t x) {
+        return (x + 63) & ~(uint64_t)63;
+    }
+};
+
+#endif
@@ -0,0 +1,216 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+
+#include "csr_graph.h"
+#include "edge_list.h"
+#include "../../MySTL/mapped_file.h"
+
+using namespace std;
+
+/*====================================================
+    csrtoolı߱ <->  CSR ͼļ
+      csrtool c <߱> <ͼļ> [-t ߳] [-directed]   ת
+      csrtool i <ͼļ> [-verify]                         ӳ䲢ӡϢ
+      csrtool g <߱> <> <> []              ߱
+      csrtool b <߱> [-t ߳]                         /ͼ//ӳʱ
+    룺g++ -O2 -pthread csrtool.cpp -o csrtool
+====================================================*/
+
+static void usage() {
+    cerr << "÷:" << endl
+         << "  csrtool c <߱> <ͼļ> [-t ߳] [-directed]" << endl
+         << "  csrtool i <ͼļ> [-verify]" << endl
+         << "  csrtool g <߱> <> <> []" << endl
+         << "  csrtool b <߱> [-t ߳]" << endl;
+}
+
+static double secondsSince(chrono::steady_clock::time_point t0) {
+    return chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+}
+
+// 飺strtol ߳
+static vector<GraphEdge> strtolParse(const char* data, size_t n) {
+    vector<GraphEdge> out;
+    string buf(data, n);
+    const char* p = buf.c_str();
+    const char* end = p + n;
+    while (p < end) {
+        const char* nl = (const char*)memchr(p, '\n', end - p);
+        const char* le = nl ? nl : end;
+        if (*p != '#' && *p != '%') {
+            char* q;
+            long f[3] = {0, 0, 1};
+            int k = 0;
+            const char* s = p;
+            while (k < 3) {
+                long v = strtol(s, &q, 10);
+                if (q == s || q > le) break;
+                f[k++] = v;
+                s = q;
+            }
+            if (k >= 2) out.push_back(GraphEdge{(int)f[0], (int)f[1], (int)f[2]});
+        }
+        p = le + 1;
+    }
+    return out;
+}
+
+static int convert(const string& in, const string& out, bool undirected, MySTL::ThreadPool& pool) {
+    MySTL::MappedFile f;
+    if (!f.open(in)) {
+        cerr << "޷ļ: " << in << endl;
+        return 1;
+    }
+    auto t0 = chrono::steady_clock::now();
+    int V = 0;
+    vector<GraphEdge> edges = parseEdgeList((const char*)f.data(), f.size(), &pool, &V);
+    double tp = secondsSince(t0);
+    t0 = chrono::steady_clock::now();
+    CSRGraph g(V, edges, undirected, &pool);
+    double tb = secondsSince(t0);
+    t0 = chrono::steady_clock::now();
+    g.saveFile(out);
+    double ts = secondsSince(t0);
+    printf(" %d   %zu   %zu\n %.3f s  ͼ %.3f s   %.3f s\n",
+           V, edges.size(), (size_t)g.arcCount(), tp, tb, ts);
+    return 0;
+}
+
+static int info(const string& path, bool verify) {
+    auto t0 = chrono::steady_clock::now();
+    CSRGraph g(0, vector<GraphEdge>());
+    g.attachFile(path, verify);
+    double ta = secondsSince(t0);
+    int maxDeg = 0;
+    for (int u = 0; u < g.vertexCount(); ++u) maxDeg = max(maxDeg, g.degree(u));
+    t0 = chrono::steady_clock::now();
+    size_t reached = g.vertexCount() ? g.BFS(0).size() : 0;
+    double tbfs = secondsSince(t0);
+    printf("%s\n %d   %zu   %d\nӳ%s %.3f ms  BFS(0)  %zu  %.3f s\n",
+           path.c_str(), g.vertexCount(), (size_t)g.arcCount(), maxDeg,
+           verify ? "+У" : "", ta * 1e3, reached, tbfs);
+    return 0;
+}
+
+static int generate(const string& path, long V, long E, unsigned seed) {
+    if (V <= 0 || V > INT_MAX || E < 0) {
+        cerr << "Ϸ" << endl;
+        return 1;
+    }
+    FILE* f = fopen(path.c_str(), "wb");
+    if (!f) {
+        cerr << "޷ļ: " << path << endl;
+        return 1;
+    }
+    mt19937 rng(seed);
+    uniform_int_distribution<int> vd(0, (int)V - 1), wd(1, 1000);
+    fprintf(f, "# random graph V=%ld E=%ld seed=%u\n", V, E, seed);
+    for (long i = 0; i < E; ++i) {
+        int a = vd(rng), b = vd(rng), w = wd(rng);
+        fprintf(f, "%d %d %d\n", a, b, w);
+    }
+    if (fclose(f) != 0) {
+        cerr << "дʧ: " << path << endl;
+        return 1;
+    }
+    return 0;
+}
+
+static bool sameEdges(const vector<GraphEdge>& a, const vector<GraphEdge>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].u != b[i].u || a[i].v != b[i].v || a[i].w != b[i].w) return false;
+    return true;
+}
+
+static int bench(const string& path, MySTL::ThreadPool& pool) {
+    MySTL::MappedFile f;
+    if (!f.open(path)) {
+        cerr << "޷ļ: " << path << endl;
+        return 1;
+    }
+    const char* data = (const char*)f.data();
+    size_t n = f.size();
+    double mb = n / 1048576.0;
+    printf("%s  %.1f MB  ߳ %d\n", path.c_str(), mb, pool.size());
+
+    auto t0 = chrono::steady_clock::now();
+    vector<GraphEdge> base = strtolParse(data, n);
+    double t1 = secondsSince(t0);
+    t0 = chrono::steady_clock::now();
+    vector<GraphEdge> serial = parseEdgeList(data, n);
+    double t2 = secondsSince(t0);
+    int V = 0;
+    t0 = chrono::steady_clock::now();
+    vector<GraphEdge> par = parseEdgeList(data, n, &pool, &V);
+    double t3 = secondsSince(t0);
+    bool ok = sameEdges(base, serial) && sameEdges(base, par);
+    printf("strtol       %8.1f MB/s\nSWAR ߳  %8.1f MB/s (x%.2f)\nSWAR     %8.1f MB/s (x%.2f)  %s\n",
+           mb / t1, mb / t2, t1 / t2, mb / t3, t1 / t3, ok ? "OK" : "һ");
+
+    t0 = chrono::steady_clock::now();
+    CSRGraph g(V, par, true, &pool);
+    double tb = secondsSince(t0);
+    string out = path + ".csr";
+    t0 = chrono::steady_clock::now();
+    g.saveFile(out);
+    double ts = secondsSince(t0);
+
+    // ӳ޷лȡǰĶ֤
+    t0 = chrono::steady_clock::now();
+    CSRGraph m(0, vector<GraphEdge>());
+    m.attachFile(out);
+    double ta = secondsSince(t0);
+    bool same = m.vertexCount() == g.vertexCount() && m.arcCount() == g.arcCount();
+    for (int u = 0; same && u < g.vertexCount(); ++u)
+        same = g.degree(u) == m.degree(u) &&
+               memcmp(&g.adj[g.offsets[u]], &m.adj[m.offsets[u]], g.degree(u) * sizeof(int)) == 0;
+    printf("ͼ %.3f s   %.3f s  ӳ %.3f ms  %s\n", tb, ts, ta * 1e3, same ? "OK" : "ӳһ");
+    remove(out.c_str());
+    return ok && same ? 0 : 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        usage();
+        return 1;
+    }
+    string cmd = argv[1];
+    int threads = 0;     // 0 ʾȡӲ߳
+    bool undirected = true, verify = false;
+
+    vector<string> args;
+    for (int i = 2; i < argc; ++i) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-directed") == 0)
+            undirected = false;
+        else if (strcmp(argv[i], "-verify") == 0)
+            verify = true;
+        else
+            args.push_back(argv[i]);
+    }
+
+    try {
+        if (cmd == "i" && args.size() == 1) return info(args[0], verify);
+        if (cmd == "g" && (args.size() == 3 || args.size() == 4))
+            return generate(args[0], atol(args[1].c_str()), atol(args[2].c_str()),
+                            args.size() == 4 ? (unsigned)atol(args[3].c_str()) : 2025u);
+
+        MySTL::ThreadPool pool(threads);
+        if (cmd == "c" && args.size() == 2) return convert(args[0], args[1], undirected, pool);
+        if (cmd == "b" && args.size() == 1) return bench(args[0], pool);
+        usage();
+        return 1;
+    } catch (const exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+}
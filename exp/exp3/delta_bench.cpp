@@ -0,0 +1,116 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+#include "shortest_path.h"
+#include "delta_stepping.h"
+
+using namespace std;
+
+/*====================================================
+    Delta-stepping ԣV = 10^6E = 10^7 ͼ
+      գShortestPath Ĳ / ѣУ
+      ͬ deltaͬ߳µʱ˶Ծǰ
+      Сͼع飺0 Ȩ߳ɻdist Ϊ 0 ķԴ㡢ͼ
+    룺g++ -O2 -pthread delta_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static vector<GraphEdge> randomGraph(int V, size_t E, int maxW, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<GraphEdge> edges;
+    edges.reserve(E);
+    for (int v = 1; v < V && edges.size() < E; ++v) {
+        GraphEdge e = {(int)(rng() % v), v, (int)(rng() % maxW) + 1};
+        edges.push_back(e);
+    }
+    while (edges.size() < E) {
+        GraphEdge e = {(int)(rng() % V), (int)(rng() % V), (int)(rng() % maxW) + 1};
+        if (e.u != e.v) edges.push_back(e);
+    }
+    return edges;
+}
+
+// ÿɴﶥǰ u һ u -> v Ľߣǰ߻Դ
+static bool validPred(const CSRGraph& g, const vector<long long>& d, const vector<int>& p, int s) {
+    if (p[s] != -1) return false;
+    for (int v = 0; v < g.V; ++v) {
+        if (v == s) continue;
+        if (d[v] == CSR_INF) {
+            if (p[v] != -1) return false;
+            continue;
+        }
+        int u = p[v];
+        if (u < 0) return false;
+        bool found = false;
+        for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1] && !found; ++k)
+            found = g.adj[k] == v && d[u] + g.weight[k] == d[v];
+        if (!found) return false;
+        int steps = 0;
+        for (int x = v; x != s; x = p[x])
+            if (x < 0 || ++steps > g.V) return false;
+    }
+    return true;
+}
+
+// Сͼع飺0 Ȩ߳ɻdist Ϊ 0 ķԴ㡢ͼ
+static bool smallCase(const char* name, int V, const vector<GraphEdge>& edges, bool undirected, int s) {
+    CSRGraph g(V, edges, undirected);
+    ShortestPath sp(g);
+    sp.run(s, -1, ShortestPath::QUAD_HEAP);
+    DeltaStepping ds(g);
+    ds.run(s);
+    bool ok = ds.distances() == sp.distances() && validPred(g, sp.distances(), ds.predecessors(), s);
+    printf("  %-28s %s\n", name, ok ? "OK" : "һ");
+    return ok;
+}
+
+static void runCase(int V, size_t E, int maxW) {
+    CSRGraph g(V, randomGraph(V, E, maxW, 17));
+    printf("\nV = %d  E = %zu  Ȩ 1~%d\n", V, E, maxW);
+
+    ShortestPath sp(g);
+    double tq = timeMs([&] { sp.run(0, -1, ShortestPath::QUAD_HEAP); });
+    double tr = timeMs([&] { sp.run(0, -1, ShortestPath::RADIX_HEAP); });
+    vector<long long> ref = sp.distances();
+    printf("   Ĳ %8.1f ms    %8.1f ms\n", tq, tr);
+
+    long long def = DeltaStepping(g).bucketWidth();
+    long long deltas[] = {max(1LL, def / 8), def, def * 8, (long long)maxW};
+    for (int di = 0; di < 4; ++di) {
+        for (int t = 1; t <= 4; t *= 2) {
+            MySTL::ThreadPool pool(t);
+            DeltaStepping ds(g, &pool, deltas[di]);
+            double td = timeMs([&] { ds.run(0); });
+            bool ok = ds.distances() == ref;
+            if (di == 1) ok = ok && validPred(g, ref, ds.predecessors(), 0);
+            printf("  delta %7lld%s %d ߳ %8.1f msĲ x%.2f   %6zu  %s\n",
+                   deltas[di], di == 1 ? "Ĭϣ" : "        ", t, td, tq / td, ds.phaseCount(),
+                   ok ? "OK" : "һ");
+        }
+    }
+}
+
+int main() {
+    cout << "==== Delta-stepping ԣӲ߳ " << thread::hardware_concurrency() << "====" << endl;
+    bool ok = true;
+    printf("\nСͼǰع\n");
+    ok = smallCase("0 Ȩ߳ɻ", 4, {{3, 1, 1}, {3, 2, 1}, {1, 2, 0}}, true, 3) && ok;
+    ok = smallCase("dist Ϊ 0 ķԴ", 4, {{0, 1, 1}, {0, 3, 0}}, true, 0) && ok;
+    ok = smallCase("ͼ", 5, {{0, 1, 2}, {1, 2, 0}, {0, 2, 5}, {2, 3, 1}, {4, 0, 1}}, false, 0) && ok;
+    ok = smallCase(" 0 Ȩ", 4, {{0, 1, 0}, {1, 2, 0}, {2, 1, 0}, {2, 3, 3}}, false, 0) && ok;
+    if (!ok) return 1;
+    runCase(1000000, 10000000, 100);
+    runCase(1000000, 10000000, 1000000);
+    return 0;
+}
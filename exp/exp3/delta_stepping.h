@@ -0,0 +1,231 @@
+#ifndef DELTA_STEPPING_H
+#define DELTA_STEPPING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    Delta-stepping Դ·Meyer & Sanders
+    - 밴 delta ͰͬһͰڵĶ㲢ɳ
+    - ߣw <= deltaصǰͰֱͰգ
+      رֻͰպͰڳֹĶɳһ
+    - ÿ߳ԼһͰɳʱֻд̵߳Ͱ
+      Ͱ maxW / delta + 2 ѭʹ
+    - dist  CAS ȡСǰڽؽߴԴ㽨
+    ҪȨǸ
+====================================================*/
+class DeltaStepping {
+public:
+    // delta <= 0 ʱȡ Ȩ / ƽ
+    explicit DeltaStepping(const CSRGraph& graph, MySTL::ThreadPool* threadPool = nullptr, long long delta = 0)
+        : g(graph), pool(threadPool ? threadPool : &single), single(1), dist(new std::atomic<long long>[graph.V]) {
+        int maxW = 0;
+        for (size_t k = 0; k < g.weight.size(); ++k) {
+            if (g.weight[k] < 0) throw std::invalid_argument("DeltaStepping: negative edge weight");
+            maxW = std::max(maxW, g.weight[k]);
+        }
+        if (delta <= 0) {
+            double avgDeg = g.V ? (double)g.arcCount() / g.V : 1.0;
+            delta = std::max(1LL, (long long)(maxW / std::max(1.0, avgDeg)));
+        }
+        width = delta;
+        nb = (size_t)(maxW / width) + 2;
+
+        // ÿڽӱΪ ǰرں
+        lightEnd.resize(g.V);
+        adj.resize(g.arcCount());
+        weight.resize(g.arcCount());
+        pool->parallelFor((size_t)g.V, 1 << 12, [&](size_t b, size_t e, int) {
+            for (size_t u = b; u < e; ++u) {
+                uint64_t at = g.offsets[u];
+                for (int pass = 0; pass < 2; ++pass) {
+                    for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                        if ((g.weight[k] <= width) != (pass == 0)) continue;
+                        adj[at] = g.adj[k];
+                        weight[at] = g.weight[k];
+                        at++;
+                    }
+                    if (pass == 0) lightEnd[u] = at;
+                }
+            }
+        });
+        buckets.assign(pool->size(), std::vector<std::vector<int> >(nb));
+        pushed.resize(pool->size());
+        markF.assign(g.V, 0);
+        markR.assign(g.V, 0);
+        stamp = 0;
+        source = -1;
+    }
+
+    long long bucketWidth() const {
+        return width;
+    }
+
+    void run(int src) {
+        if ((unsigned)src >= (unsigned)g.V) throw std::invalid_argument("DeltaStepping: source out of range");
+        source = src;
+        pool->parallelFor((size_t)g.V, 1 << 16, [&](size_t b, size_t e, int) {
+            for (size_t v = b; v < e; ++v) dist[v].store(CSR_INF, std::memory_order_relaxed);
+        });
+        dist[source].store(0);
+        buckets[0][0].push_back(source);
+        size_t pending = 1;
+        phases = 0;
+
+        for (long long i = 0; pending > 0; ++i) {
+            size_t slot = (size_t)(i % (long long)nb);
+            if (bucketEmpty(slot)) continue;
+            newStamp();
+            R.clear();
+            for (;;) {
+                F.clear();
+                int fs = ++stamp;
+                for (size_t t = 0; t < buckets.size(); ++t) {
+                    std::vector<int>& bk = buckets[t][slot];
+                    pending -= bk.size();
+                    for (size_t j = 0; j < bk.size(); ++j) {
+                        int v = bk[j];
+                        // ѽ͵Ͱﱻ
+                        if (dist[v].load(std::memory_order_relaxed) / width != i || markF[v] == fs) continue;
+                        markF[v] = fs;
+                        F.push_back(v);
+                        if (markR[v] != rStamp) {
+                            markR[v] = rStamp;
+                            R.push_back(v);
+                        }
+                    }
+                    bk.clear();
+                }
+                if (F.empty()) break;
+                pending += relax(F, true);
+                phases++;
+            }
+            pending += relax(R, false);
+        }
+    }
+
+    long long distance(int v) const {
+        return dist[v].load(std::memory_order_relaxed);
+    }
+
+    std::vector<long long> distances() const {
+        std::vector<long long> d(g.V);
+        for (int v = 0; v < g.V; ++v) d[v] = dist[v].load(std::memory_order_relaxed);
+        return d;
+    }
+
+    /*------------------------------------------------
+        ǰԴؽߣdist[u] + w == dist[v]չ
+        һαѹ u ʱ pred[v] = uCAS ռ
+        ֻسߣͼͬã0 Ȩ߹ɵĻҲɻ
+        dist Ϊ 0 ķԴ㶥ͬǰ
+    ------------------------------------------------*/
+    std::vector<int> predecessors() const {
+        std::unique_ptr<std::atomic<int>[]> p(new std::atomic<int>[g.V]);
+        pool->parallelFor((size_t)g.V, 1 << 16, [&](size_t b, size_t e, int) {
+            for (size_t v = b; v < e; ++v) p[v].store(-1, std::memory_order_relaxed);
+        });
+        std::vector<int> frontier;
+        std::vector<std::vector<int> > next(pool->size());
+        if (source >= 0) {
+            p[source].store(source);   // ָʾϣǰ
+            frontier.push_back(source);
+        }
+        while (!frontier.empty()) {
+            pool->parallelFor(frontier.size(), 256, [&](size_t b, size_t e, int tid) {
+                std::vector<int>& out = next[tid];
+                for (size_t i = b; i < e; ++i) {
+                    int u = frontier[i];
+                    long long du = dist[u].load(std::memory_order_relaxed);
+                    for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                        int v = g.adj[k];
+                        if (du + g.weight[k] != dist[v].load(std::memory_order_relaxed)) continue;
+                        int none = -1;
+                        if (p[v].load(std::memory_order_relaxed) == -1 &&
+                            p[v].compare_exchange_strong(none, u, std::memory_order_relaxed))
+                            out.push_back(v);
+                    }
+                }
+            });
+            frontier.clear();
+            for (size_t t = 0; t < next.size(); ++t) {
+                frontier.insert(frontier.end(), next[t].begin(), next[t].end());
+                next[t].clear();
+            }
+        }
+        std::vector<int> pred(g.V);
+        for (int v = 0; v < g.V; ++v) pred[v] = p[v].load(std::memory_order_relaxed);
+        if (source >= 0) pred[source] = -1;
+        return pred;
+    }
+
+    // ϴ run ɳ
+    size_t phaseCount() const {
+        return phases;
+    }
+
+private:
+    const CSRGraph& g;
+    MySTL::ThreadPool* pool;
+    MySTL::ThreadPool single;
+    std::unique_ptr<std::atomic<long long>[]> dist;
+    long long width;
+    size_t nb;
+    std::vector<uint64_t> lightEnd;              //  u Ϊ [offsets[u], lightEnd[u])
+    std::vector<int> adj, weight;
+    std::vector<std::vector<std::vector<int> > > buckets;   // buckets[߳][Ͱ]
+    std::vector<size_t> pushed;
+    std::vector<int> F, R;
+    std::vector<int> markF, markR;               // ִδȥ
+    int stamp, rStamp;
+    int source;                                  // ϴ run Դ㣬δʱΪ -1
+    size_t phases;
+
+    void newStamp() {
+        rStamp = ++stamp;
+    }
+
+    bool bucketEmpty(size_t slot) const {
+        for (size_t t = 0; t < buckets.size(); ++t)
+            if (!buckets[t][slot].empty()) return false;
+        return true;
+    }
+
+    // ɳ vs и߻رߣͰ
+    size_t relax(const std::vector<int>& vs, bool light) {
+        std::fill(pushed.begin(), pushed.end(), 0);
+        pool->parallelFor(vs.size(), 256, [&](size_t b, size_t e, int tid) {
+            std::vector<std::vector<int> >& my = buckets[tid];
+            size_t cnt = 0;
+            for (size_t i = b; i < e; ++i) {
+                int u = vs[i];
+                long long du = dist[u].load(std::memory_order_relaxed);
+                uint64_t lo = light ? g.offsets[u] : lightEnd[u];
+                uint64_t hi = light ? lightEnd[u] : g.offsets[u + 1];
+                for (uint64_t k = lo; k < hi; ++k) {
+                    int v = adj[k];
+                    long long nd = du + weight[k];
+                    long long old = dist[v].load(std::memory_order_relaxed);
+                    while (nd < old && !dist[v].compare_exchange_weak(old, nd, std::memory_order_relaxed)) {}
+                    if (nd < old) {
+                        my[(size_t)(nd / width % (long long)nb)].push_back(v);
+                        cnt++;
+                    }
+                }
+            }
+            pushed[tid] += cnt;
+        });
+        size_t total = 0;
+        for (size_t t = 0; t < pushed.size(); ++t) total += pushed[t];
+        return total;
+    }
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "graph.h"
+#include "shortest_path.h"
+
+using namespace std;
+
+/*====================================================
+    Dijkstra Աȣ
+         : Graph::dijkstraO(V^2) ѡ
+      CSR  : CSRGraph::dijkstrastd::priority_queue + 
+       / Ĳ /  : ShortestPath
+    ԵǰԴ
+    룺g++ -O2 -pthread dijkstra_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static vector<GraphEdge> randomGraph(int V, size_t E, int maxW, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<GraphEdge> edges;
+    edges.reserve(E);
+    for (int v = 1; v < V && edges.size() < E; ++v) {
+        GraphEdge e = {(int)(rng() % v), v, (int)(rng() % maxW) + 1};
+        edges.push_back(e);
+    }
+    while (edges.size() < E) {
+        GraphEdge e = {(int)(rng() % V), (int)(rng() % V), (int)(rng() % maxW) + 1};
+        if (e.u != e.v) edges.push_back(e);
+    }
+    return edges;
+}
+
+static const char* kindName[] = {"", "Ĳ", ""};
+
+// Сͼ˶ԣɴԭʵڴ
+static void compareSmall() {
+    const int V = 3000;
+    vector<GraphEdge> edges = randomGraph(V / 2, 15000, 100, 3);
+    // һ붥Գһͨ飬 0 ɴ
+    vector<GraphEdge> other = randomGraph(V / 2, 15000, 100, 4);
+    for (size_t i = 0; i < other.size(); ++i) {
+        other[i].u += V / 2;
+        other[i].v += V / 2;
+        edges.push_back(other[i]);
+    }
+    Graph g(V);
+    for (size_t i = 0; i < edges.size(); ++i) g.addEdge(edges[i].u, edges[i].v, edges[i].w);
+    // Ḳرߣþµı߽ CSR֤ͬһͼ
+    vector<GraphEdge> kept;
+    for (int u = 0; u < V; ++u)
+        for (int v = u + 1; v < V; ++v)
+            if (g.adjMatrix[u][v]) {
+                GraphEdge e = {u, v, g.adjMatrix[u][v]};
+                kept.push_back(e);
+            }
+    CSRGraph c(V, kept);
+
+    ostringstream os;
+    streambuf* old = cout.rdbuf(os.rdbuf());
+    double tm = timeMs([&] { g.dijkstra(0); });
+    cout.rdbuf(old);
+
+    ShortestPath sp(c);
+    printf("V = %d  E = %zuһ붥㲻ɴ   %7.2f ms\n", V, kept.size(), tm);
+    for (int k = 0; k < 3; ++k) {
+        double t = timeMs([&] { sp.run(0, -1, (ShortestPath::HeapKind)k); });
+        ostringstream ref;
+        for (int i = 0; i < V; ++i)
+            ref << "Distance from 0 to " << i << ": "
+                << (sp.distance(i) == CSR_INF ? INT_MAX : sp.distance(i)) << endl;
+        printf("  %s %7.2f ms  %s\n", kindName[k], t, ref.str() == os.str() ? "һ" : "һ");
+    }
+}
+
+static void sparseLarge(int V, size_t E, int maxW) {
+    vector<GraphEdge> edges = randomGraph(V, E, maxW, 11);
+    CSRGraph c(V, edges);
+    printf("\nV = %d  E = %zu  Ȩ 1~%d\n", V, E, maxW);
+
+    vector<long long> ref;
+    double tl = timeMs([&] { ref = c.dijkstra(0); });
+    printf("  CSR Զ %8.1f ms\n", tl);
+
+    ShortestPath sp(c);
+    for (int k = 0; k < 3; ++k) {
+        double t = timeMs([&] { sp.run(0, -1, (ShortestPath::HeapKind)k); });
+        bool ok = sp.distances() == ref;
+        // ǰϵľӦǡòһ
+        for (int v = 0; ok && v < V; v += 997) {
+            int p = sp.predecessor(v);
+            if (p < 0) continue;
+            long long best = CSR_INF;
+            for (uint64_t j = c.offsets[p]; j < c.offsets[p + 1]; ++j)
+                if (c.adj[j] == v) best = min(best, (long long)c.weight[j]);
+            ok = sp.distance(p) + best == sp.distance(v);
+        }
+        printf("  %s     %8.1f ms (x%.2f)  %s\n", kindName[k], t, tl / t, ok ? "OK" : "һ");
+    }
+
+    // Ե㣺ÿζȫͼ vs ǰ + ù
+    const int Q = 200;
+    mt19937 rng(5);
+    vector<pair<int, int> > qs(Q);
+    for (int i = 0; i < Q; ++i) qs[i] = make_pair((int)(rng() % V), (int)(rng() % V));
+    const int FULL = 10;
+    long long s1 = 0, s2 = 0;
+    double tf = timeMs([&] {
+        for (int i = 0; i < FULL; ++i) s1 += c.dijkstra(qs[i].first)[qs[i].second];
+    });
+    size_t touched = 0;
+    double te = timeMs([&] {
+        for (int i = 0; i < Q; ++i) {
+            sp.run(qs[i].first, qs[i].second, ShortestPath::QUAD_HEAP);
+            if (i < FULL) s2 += sp.distance(qs[i].second);
+            touched += sp.touchedCount();
+        }
+    });
+    printf("  Ե㣺ȫͼ %8.2f ms/   ǰ %8.2f ms/Σƽ %zu 㣩  %s\n",
+           tf / FULL, te / Q, touched / Q, s1 == s2 ? "OK" : "һ");
+
+    // ԴԴֱСֵȽ
+    vector<int> src;
+    for (int i = 0; i < 8; ++i) src.push_back((int)(rng() % V));
+    vector<long long> best(V, CSR_INF);
+    for (size_t i = 0; i < src.size(); ++i) {
+        sp.run(src[i]);
+        for (int v = 0; v < V; ++v) best[v] = min(best[v], sp.distance(v));
+    }
+    double tm = timeMs([&] { sp.run(src); });
+    printf("  8 Դͬʱ %8.1f ms  %s\n", tm, sp.distances() == best ? "OK" : "һ");
+}
+
+int main() {
+    cout << "==== Dijkstra  ====" << endl;
+    compareSmall();
+    sparseLarge(100000, 1000000, 100);
+    sparseLarge(1000000, 10000000, 100);
+    sparseLarge(1000000, 10000000, 1000000);
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <iostream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "dynamic_graph.h"
+#include "shortest_path.h"
+
+using namespace std;
+
+/*====================================================
+    ̬ͼӳ٣ÿɾ k/2 бߡ k/2 ±
+         : DynamicGraph::applyBatch + DynamicSSSP::repair
+               + һͨԲѯҪʱؽ鼯
+         : ڵ CSR պ ShortestPath ͷ
+    ÿ˶
+    룺g++ -O2 -pthread dynamic_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static vector<GraphEdge> randomGraph(int V, size_t E, int maxW, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<GraphEdge> edges;
+    edges.reserve(E);
+    while (edges.size() < E) {
+        GraphEdge e = {(int)(rng() % V), (int)(rng() % V), (int)(rng() % maxW) + 1};
+        if (e.u != e.v) edges.push_back(e);
+    }
+    return edges;
+}
+
+// бɾ±߲
+static void makeBatch(const DynamicGraph& g, int k, int maxW, mt19937_64& rng,
+                      vector<GraphEdge>& ins, vector<GraphEdge>& del) {
+    int V = g.vertexCount();
+    ins.clear();
+    del.clear();
+    while ((int)del.size() < k / 2) {
+        int u = (int)(rng() % V);
+        const vector<DynamicGraph::Arc>& a = g.neighbors(u);
+        if (a.empty()) continue;
+        GraphEdge e = {u, a[rng() % a.size()].to, 0};
+        del.push_back(e);
+    }
+    while ((int)ins.size() < k - k / 2) {
+        GraphEdge e = {(int)(rng() % V), (int)(rng() % V), (int)(rng() % maxW) + 1};
+        if (e.u != e.v) ins.push_back(e);
+    }
+}
+
+int main() {
+    const int V = 200000;
+    const size_t E = 1000000;
+    const int maxW = 1000;
+    const int rounds = 20;
+    int batchSizes[] = {1, 10, 100, 1000, 10000};
+
+    DynamicGraph g(V, randomGraph(V, E, maxW, 2025));
+    DynamicSSSP sssp(g, 0);
+    mt19937_64 rng(7);
+
+    printf("==== ̬ͼ ====\n");
+    printf("V=%d  E=%zu   %d  ÿС %d \n", V, g.edgeCount(), g.componentCount(), rounds);
+
+    bool allOk = true;
+
+    // ع飺ɾ֧űʹ鼯ںٲߣ±Ҳ鼯
+    {
+        DynamicGraph t(3);
+        t.insertEdge(0, 1, 1);
+        t.removeEdge(0, 1);
+        t.insertEdge(1, 2, 1);
+        bool ok = t.connected(1, 2) && !t.connected(0, 1) && t.componentCount() == 2;
+        allOk = allOk && ok;
+        printf(" / ɾ /  ͨѯ %s\n", ok ? "OK" : "һ");
+    }
+
+    vector<GraphEdge> ins, del;
+    for (int bi = 0; bi < 5; ++bi) {
+        int k = batchSizes[bi];
+        double tUpd = 0, tRep = 0, tConn = 0, tFull = 0;
+        size_t touched = 0, rebuilt = g.rebuildCount(), spared = g.reconnectCount();
+        bool ok = true;
+        for (int r = 0; r < rounds; ++r) {
+            makeBatch(g, k, maxW, rng, ins, del);
+            vector<EdgeChange> changes;
+            tUpd += timeMs([&] { changes = g.applyBatch(ins, del); });
+            tRep += timeMs([&] { touched += sssp.repair(changes); });
+            int a = (int)(rng() % V), b = (int)(rng() % V);
+            bool conn = false;
+            tConn += timeMs([&] { conn = g.connected(a, b); });
+
+            // 㣺 + ͷ Dijkstra
+            vector<long long> ref;
+            tFull += timeMs([&] {
+                CSRGraph snap = g.snapshot();
+                ShortestPath sp(snap);
+                sp.run(0);
+                ref = sp.distances();
+            });
+            for (int v = 0; v < V; ++v)
+                if (ref[v] != sssp.distance(v)) ok = false;
+            if (conn != (ref[a] != CSR_INF && ref[b] != CSR_INF) && (ref[a] != CSR_INF || ref[b] != CSR_INF))
+                ok = false;
+        }
+        allOk = allOk && ok;
+        double inc = (tUpd + tRep + tConn) / rounds;
+        printf(" %5d | ͼ %8.3f ms  ޸ %8.3f ms (ƽض %8.0f )  ͨѯ %7.3f ms"
+               "  ؽ %2zu   %5zu  |  %8.2f ms | x%.0f  %s\n",
+               k, tUpd / rounds, tRep / rounds, (double)touched / rounds, tConn / rounds,
+               g.rebuildCount() - rebuilt, g.reconnectCount() - spared, tFull / rounds, tFull / rounds / inc, ok ? "OK" : "һ");
+    }
+
+    // 룺鼯ؽ
+    double tIns = timeMs([&] {
+        for (int r = 0; r < 1000; ++r) {
+            GraphEdge e = {(int)(rng() % V), (int)(rng() % V), 1};
+            vector<GraphEdge> one(1, e);
+            sssp.repair(g.applyBatch(one, vector<GraphEdge>()));
+            g.connected(e.u, 0);
+        }
+    });
+    printf("߲ + ޸ + ͨѯ: %.3f ms/\n", tIns / 1000);
+    return allOk ? 0 : 1;
+}
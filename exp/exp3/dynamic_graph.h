@@ -0,0 +1,405 @@
+#ifndef DYNAMIC_GRAPH_H
+#define DYNAMIC_GRAPH_H
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_graph.h"
+#include "mst.h"
+#include "shortest_path.h"
+
+/*====================================================
+    ̬ͼ/ɾߣά
+      ͨԣ鼯ֻܲ룻άһ"֧ű"
+              ֤ÿ֧ű߾ͨɾ֧űͨԲ䣻
+              ɾ֧űʱ޲˫ BFS ·
+              ҵͰ·ϵı߲Ϊ֧űߣҲűǹڣ
+              ´βѯʱؽ
+      Դ·DynamicSSSP ֻӰĶ
+    رߣظͬһΪȨ
+====================================================*/
+
+// һߵʵʱ仯Ȩֵ -1 ʾ
+struct EdgeChange {
+    int u, v;
+    int oldW, newW;
+};
+
+class DynamicGraph {
+public:
+    struct Arc {
+        int to;
+        int w;
+        bool forest;   //  u < to һЧǷΪ֧ű
+    };
+
+    // searchBudgetɾ֧űʱ·ɨĻ0 ʾֱӱǹ
+    explicit DynamicGraph(int n, const std::vector<GraphEdge>& list = std::vector<GraphEdge>(),
+                          size_t searchBudget = 4096)
+        : V(n), edges(0), nbr(n < 0 ? 0 : n), dsu(n < 0 ? 0 : n), comps(n), stale(false), rebuilds(0), reconnects(0),
+          budget(searchBudget), seen(n < 0 ? 0 : n, 0), via(n < 0 ? 0 : n, -1), epoch(0) {
+        if (n < 0) throw std::invalid_argument("DynamicGraph: negative vertex count");
+        for (size_t i = 0; i < list.size(); ++i) insertEdge(list[i].u, list[i].v, list[i].w);
+    }
+
+    int vertexCount() const {
+        return V;
+    }
+
+    size_t edgeCount() const {
+        return edges;
+    }
+
+    const std::vector<Arc>& neighbors(int u) const {
+        return nbr[u];
+    }
+
+    // Ȩڷ -1
+    int edgeWeight(int u, int v) const {
+        check(u, v);
+        int k = find(u, v);
+        return k < 0 ? -1 : nbr[u][k].w;
+    }
+
+    bool hasEdge(int u, int v) const {
+        return edgeWeight(u, v) >= 0;
+    }
+
+    /*------------------------------------------------
+        ȨؾȨ-1 ʾ±ߣ
+        ԻӰͨԺ·ֱӺ
+    ------------------------------------------------*/
+    int insertEdge(int u, int v, int w) {
+        check(u, v);
+        if (w < 0) throw std::invalid_argument("DynamicGraph: negative weight");
+        if (u == v) return w;
+        int k = find(u, v);
+        if (k >= 0) {
+            int old = nbr[u][k].w;
+            nbr[u][k].w = w;
+            nbr[v][find(v, u)].w = w;
+            return old;
+        }
+        // ʱҲҪϲ鼯ʼͨԵϽƣconnected() ǰ
+        bool merged = dsu.unite(u, v) && !stale;
+        if (merged) comps--;
+        Arc a = {v, w, u < v && merged};
+        Arc b = {u, w, v < u && merged};
+        nbr[u].push_back(a);
+        nbr[v].push_back(b);
+        edges++;
+        return -1;
+    }
+
+    // ɾߣؾȨ-1 ʾûУ
+    int removeEdge(int u, int v) {
+        check(u, v);
+        int k = find(u, v);
+        if (k < 0) return -1;
+        int old = nbr[u][k].w;
+        bool span = u < v ? nbr[u][k].forest : nbr[v][find(v, u)].forest;
+        eraseArc(u, k);
+        eraseArc(v, find(v, u));
+        edges--;
+        if (span && !stale && !reconnect(u, v)) stale = true;
+        return old;
+    }
+
+    /*------------------------------------------------
+        ɾ壬ʵʷı仯 DynamicSSSP::repair
+    ------------------------------------------------*/
+    std::vector<EdgeChange> applyBatch(const std::vector<GraphEdge>& inserts,
+                                       const std::vector<GraphEdge>& removes) {
+        std::vector<EdgeChange> log;
+        log.reserve(inserts.size() + removes.size());
+        for (size_t i = 0; i < removes.size(); ++i) {
+            int old = removeEdge(removes[i].u, removes[i].v);
+            if (old >= 0) log.push_back(EdgeChange{removes[i].u, removes[i].v, old, -1});
+        }
+        for (size_t i = 0; i < inserts.size(); ++i) {
+            const GraphEdge& e = inserts[i];
+            int old = insertEdge(e.u, e.v, e.w);
+            if (old != e.w) log.push_back(EdgeChange{e.u, e.v, old, e.w});
+        }
+        return log;
+    }
+
+    bool connected(int u, int v) {
+        check(u, v);
+        // ܻϲ鼯ɾ߲𣺲鼯ﲻͨһͨ
+        if (dsu.find(u) != dsu.find(v)) return false;
+        if (!stale) return true;
+        rebuildConnectivity();
+        return dsu.find(u) == dsu.find(v);
+    }
+
+    int componentCount() {
+        if (stale) rebuildConnectivity();
+        return comps;
+    }
+
+    // õǰ߼ؽ鼯֧ű߻ָΪһɭ֣O(V + E)
+    void rebuildConnectivity() {
+        dsu.reset(V);
+        comps = V;
+        for (int u = 0; u < V; ++u) {
+            for (size_t k = 0; k < nbr[u].size(); ++k) {
+                Arc& a = nbr[u][k];
+                if (a.to < u) continue;
+                a.forest = dsu.unite(u, a.to);
+                if (a.forest) comps--;
+            }
+        }
+        stale = false;
+        rebuilds++;
+    }
+
+    // ͨؽĴ
+    size_t rebuildCount() const {
+        return rebuilds;
+    }
+
+    // ɾ֧űߺ󿿾ֲҵ·Ĵ
+    size_t reconnectCount() const {
+        return reconnects;
+    }
+
+    // ǰ߼ CSR գ
+    CSRGraph snapshot(MySTL::ThreadPool* pool = nullptr) const {
+        std::vector<GraphEdge> list;
+        list.reserve(edges);
+        for (int u = 0; u < V; ++u)
+            for (size_t k = 0; k < nbr[u].size(); ++k)
+                if (u < nbr[u][k].to) list.push_back(GraphEdge{u, nbr[u][k].to, nbr[u][k].w});
+        return CSRGraph(V, list, true, pool);
+    }
+
+private:
+    int V;
+    size_t edges;
+    std::vector<std::vector<Arc> > nbr;
+    DisjointSet dsu;
+    int comps;        // 鼯ķstale ʱ
+    bool stale;       // ɾɭֱߣ鼯ܰѶϿĶһ
+    size_t rebuilds;
+    size_t reconnects;
+    size_t budget;
+    std::vector<unsigned> seen;   // ˫ BFS ǣepoch * 2 + 
+    std::vector<int> via;         // BFS ϵǰ
+    unsigned epoch;
+    std::vector<int> queue[2];
+
+    void check(int u, int v) const {
+        if (u < 0 || u >= V || v < 0 || v >= V) throw std::invalid_argument("DynamicGraph: vertex out of range");
+    }
+
+    // ڽӱ v ±꣬ƽȲɨ輴
+    int find(int u, int v) const {
+        const std::vector<Arc>& a = nbr[u];
+        for (size_t k = 0; k < a.size(); ++k)
+            if (a[k].to == v) return (int)k;
+        return -1;
+    }
+
+    void markSpan(int u, int v) {
+        if (u > v) std::swap(u, v);
+        nbr[u][find(u, v)].forest = true;
+    }
+
+    /*------------------------------------------------
+        uv ֧ű߸ձɾ˽չСһ࣬
+        ˵ͨ·Ϊ֧űߣ
+        ĳ˵ȷʵϿԤ
+    ------------------------------------------------*/
+    bool reconnect(int u, int v) {
+        if (budget == 0) return false;
+        if (++epoch >= 0x7FFFFFFFu) {
+            std::fill(seen.begin(), seen.end(), 0u);
+            epoch = 1;
+        }
+        unsigned tag[2] = {epoch * 2, epoch * 2 + 1};
+        int root[2] = {u, v};
+        size_t head[2] = {0, 0};
+        for (int s = 0; s < 2; ++s) {
+            queue[s].clear();
+            queue[s].push_back(root[s]);
+            seen[root[s]] = tag[s];
+            via[root[s]] = -1;
+        }
+        size_t scanned = 0;
+        while (head[0] < queue[0].size() && head[1] < queue[1].size() && scanned < budget) {
+            int s = queue[0].size() - head[0] <= queue[1].size() - head[1] ? 0 : 1;
+            int x = queue[s][head[s]++];
+            const std::vector<Arc>& a = nbr[x];
+            scanned += a.size();
+            for (size_t k = 0; k < a.size(); ++k) {
+                int y = a[k].to;
+                if (seen[y] == tag[s]) continue;
+                if (seen[y] == tag[s ^ 1]) {
+                    markSpan(x, y);
+                    for (int p = x; via[p] >= 0; p = via[p]) markSpan(p, via[p]);
+                    for (int p = y; via[p] >= 0; p = via[p]) markSpan(p, via[p]);
+                    reconnects++;
+                    return true;
+                }
+                seen[y] = tag[s];
+                via[y] = x;
+                queue[s].push_back(y);
+            }
+        }
+        return false;
+    }
+
+    // ĩβɾ֧ű߱ǸŻߣλӰ
+    void eraseArc(int u, int k) {
+        nbr[u][k] = nbr[u].back();
+        nbr[u].pop_back();
+    }
+};
+
+/*====================================================
+    Դ·ǸȨ Ramalingam-Reps
+    1. ɾȨ·ߣϣ
+    2. ϶δϵھȡСΪֵ
+    3. ȨıߣɳһΣС
+    4. ϶Ϊ DijkstraֻչСĶ
+====================================================*/
+class DynamicSSSP {
+public:
+    DynamicSSSP(const DynamicGraph& graph, int src) : g(graph), source(src), epoch(0), touched(0) {
+        if (src < 0 || src >= graph.vertexCount()) throw std::invalid_argument("DynamicSSSP: bad source");
+        recompute();
+    }
+
+    // ͷ㣬O((V + E) log V)
+    void recompute() {
+        int V = g.vertexCount();
+        dist.assign(V, CSR_INF);
+        parent.assign(V, -1);
+        mark.assign(V, 0);
+        epoch = 0;
+        heap.resize(V);
+        dist[source] = 0;
+        heap.push(source, 0);
+        touched = propagate();
+    }
+
+    /*------------------------------------------------
+        ͼ changes ֮ãر¶ֵĶ
+        ͬһڶ applyBatch ı仯һ
+    ------------------------------------------------*/
+    size_t repair(const std::vector<EdgeChange>& changes) {
+        if (++epoch == 0) {
+            std::fill(mark.begin(), mark.end(), 0u);
+            epoch = 1;
+        }
+        // 1. ӵ parent Լصǰڽӱ
+        std::vector<int>& bad = stack;
+        bad.clear();
+        for (size_t i = 0; i < changes.size(); ++i) {
+            const EdgeChange& c = changes[i];
+            if (c.newW >= 0 && c.newW <= c.oldW) continue;
+            int child = parent[c.v] == c.u ? c.v : parent[c.u] == c.v ? c.u : -1;
+            if (child < 0 || mark[child] == epoch) continue;
+            mark[child] = epoch;
+            size_t from = bad.size();
+            bad.push_back(child);
+            for (size_t k = from; k < bad.size(); ++k) {
+                int x = bad[k];
+                const std::vector<DynamicGraph::Arc>& a = g.neighbors(x);
+                for (size_t j = 0; j < a.size(); ++j) {
+                    int y = a[j].to;
+                    if (parent[y] == x && mark[y] != epoch) {
+                        mark[y] = epoch;
+                        bad.push_back(y);
+                    }
+                }
+            }
+        }
+        for (size_t k = 0; k < bad.size(); ++k) {
+            dist[bad[k]] = CSR_INF;
+            parent[bad[k]] = -1;
+        }
+
+        // 2. ϶δϵھȡֵ
+        for (size_t k = 0; k < bad.size(); ++k) {
+            int x = bad[k];
+            const std::vector<DynamicGraph::Arc>& a = g.neighbors(x);
+            for (size_t j = 0; j < a.size(); ++j) {
+                int y = a[j].to;
+                if (mark[y] == epoch || dist[y] == CSR_INF) continue;
+                if (dist[y] + a[j].w < dist[x]) {
+                    dist[x] = dist[y] + a[j].w;
+                    parent[x] = y;
+                }
+            }
+            if (dist[x] != CSR_INF) heap.push(x, dist[x]);
+        }
+
+        // 3. ±ߺͼȨ߰ǰȨֵ˫ɳ
+        for (size_t i = 0; i < changes.size(); ++i) {
+            const EdgeChange& c = changes[i];
+            if (c.newW < 0) continue;
+            int w = g.edgeWeight(c.u, c.v);
+            if (w < 0) continue;   // ֱ֮ɾ
+            relax(c.u, c.v, w);
+            relax(c.v, c.u, w);
+        }
+
+        // 4. ֻڱ仯Ķϼ Dijkstra
+        touched = bad.size() + propagate();
+        return touched;
+    }
+
+    long long distance(int v) const {
+        return dist[v];
+    }
+
+    int predecessor(int v) const {
+        return parent[v];
+    }
+
+    const std::vector<long long>& distances() const {
+        return dist;
+    }
+
+    // ϴ recompute / repair ¶ֵĶ
+    size_t touchedCount() const {
+        return touched;
+    }
+
+private:
+    const DynamicGraph& g;
+    int source;
+    std::vector<long long> dist;
+    std::vector<int> parent;
+    std::vector<unsigned> mark;   // mark[v] == epoch ʾ
+    unsigned epoch;
+    std::vector<int> stack;
+    IndexedHeap<4> heap;
+    size_t touched;
+
+    void relax(int u, int v, int w) {
+        if (dist[u] == CSR_INF || dist[u] + w >= dist[v]) return;
+        dist[v] = dist[u] + w;
+        parent[v] = u;
+        heap.push(v, dist[v]);
+    }
+
+    size_t propagate() {
+        size_t settled = 0;
+        while (!heap.empty()) {
+            std::pair<long long, int> top = heap.pop();
+            int u = top.second;
+            settled++;
+            const std::vector<DynamicGraph::Arc>& a = g.neighbors(u);
+            for (size_t j = 0; j < a.size(); ++j) relax(u, a[j].to, a[j].w);
+        }
+        return settled;
+    }
+};
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef EDGE_LIST_H
+#define EDGE_LIST_H
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    ı߱н
+      ÿ "u v [w]"հ׷ָw ȱʡΪ 1
+      '#'  '%' ͷעͣSNAP / MatrixMarket ϰߣ
+
+    1. ߳п飬߽Ƶһ֮
+    2. ÿԼ飬 SWAR һж/ת 8 λ
+    3. ǰ׺ڽλãٲпϲ
+====================================================*/
+
+namespace edge_list_detail {
+
+// 8 ֽǷȫΪ '0'~'9'
+inline bool isDigits8(uint64_t x) {
+    return (((x & 0xF0F0F0F0F0F0F0F0ULL) |
+             (((x + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+// С 8 λʮ -> γ˷
+inline uint32_t parse8Digits(uint64_t x) {
+    x = (x & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+    x = (x & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+    return (uint32_t)((x & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32);
+}
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == ',';
+}
+
+struct ParseError {
+    size_t pos;
+    const char* what;
+};
+
+/*----------------------------------------------------
+     [p, end) еһǸp ǰ֮
+    ǰβ 8 ֽʱ˻λ
+----------------------------------------------------*/
+inline long long parseNumber(const char*& p, const char* end, const char* base) {
+    bool neg = false;
+    if (p < end && *p == '-') {
+        neg = true;
+        ++p;
+    }
+    const char* first = p;
+    unsigned long long v = 0;
+    while (end - p >= 8) {
+        uint64_t x;
+        std::memcpy(&x, p, 8);
+        x -= 0x3030303030303030ULL;
+        if (!isDigits8(x + 0x3030303030303030ULL)) break;
+        v = v * 100000000ULL + parse8Digits(x);
+        p += 8;
+        if (p - first > 16) throw ParseError{(size_t)(first - base), "number too large"};
+    }
+    while (p < end && (unsigned)(*p - '0') < 10) {
+        v = v * 10 + (unsigned)(*p - '0');
+        ++p;
+    }
+    if (p == first) throw ParseError{(size_t)(first - base), "number expected"};
+    if (p - first > 10 || v > (unsigned long long)INT_MAX) throw ParseError{(size_t)(first - base), "number out of range"};
+    return neg ? -(long long)v : (long long)v;
+}
+
+//  [b, e) еУ׷ӵ outسֵ󶥵
+inline int parseRange(const char* base, const char* b, const char* e, std::vector<GraphEdge>& out) {
+    int maxId = -1;
+    const char* p = b;
+    while (p < e) {
+        while (p < e && isBlank(*p)) ++p;
+        if (p == e) break;
+        if (*p == '\n') {
+            ++p;
+            continue;
+        }
+        if (*p == '#' || *p == '%') {
+            const char* nl = (const char*)std::memchr(p, '\n', e - p);
+            p = nl ? nl + 1 : e;
+            continue;
+        }
+        long long f[3] = {0, 0, 1};
+        int k = 0;
+        while (p < e && *p != '\n') {
+            if (k == 3) throw ParseError{(size_t)(p - base), "too many fields"};
+            f[k++] = parseNumber(p, e, base);
+            if (p < e && *p != '\n' && !isBlank(*p)) throw ParseError{(size_t)(p - base), "bad character"};
+            while (p < e && isBlank(*p)) ++p;
+        }
+        if (k < 2) throw ParseError{(size_t)(p - base), "missing endpoint"};
+        if (f[0] < 0 || f[1] < 0) throw ParseError{(size_t)(p - base), "negative vertex id"};
+        out.push_back(GraphEdge{(int)f[0], (int)f[1], (int)f[2]});
+        maxId = std::max(maxId, (int)std::max(f[0], f[1]));
+    }
+    return maxId;
+}
+
+} // namespace edge_list_detail
+
+/*----------------------------------------------------
+    ıpool Ϊʱ߳
+    vertexCount ǿʱд 󶥵 + 1
+    ʽ runtime_errorϢֽƫ
+----------------------------------------------------*/
+inline std::vector<GraphEdge> parseEdgeList(const char* data, size_t n, MySTL::ThreadPool* pool = nullptr,
+                                            int* vertexCount = nullptr) {
+    using namespace edge_list_detail;
+    int threads = pool ? pool->size() : 1;
+    // С벻ֵп
+    int chunks = (int)std::max<size_t>(1, std::min<size_t>((size_t)threads * 4, n >> 16));
+
+    // ߽뵽֮
+    std::vector<size_t> cut(chunks + 1, n);
+    cut[0] = 0;
+    for (int c = 1; c < chunks; ++c) {
+        size_t pos = std::max(cut[c - 1], n / chunks * c);
+        const char* nl = pos < n ? (const char*)std::memchr(data + pos, '\n', n - pos) : nullptr;
+        cut[c] = nl ? (size_t)(nl - data) + 1 : n;
+    }
+
+    std::vector<std::vector<GraphEdge> > part(chunks);
+    std::vector<int> maxId(chunks, -1);
+    std::vector<ParseError> err(chunks, ParseError{0, nullptr});
+    auto work = [&](size_t b, size_t e, int) {
+        for (size_t c = b; c < e; ++c) {
+            // ƽгԼ 16 ֽԤ
+            part[c].reserve((cut[c + 1] - cut[c]) / 16 + 16);
+            try {
+                maxId[c] = parseRange(data, data + cut[c], data + cut[c + 1], part[c]);
+            } catch (const ParseError& pe) {
+                err[c] = pe;
+            }
+        }
+    };
+    if (pool)
+        pool->parallelFor(chunks, 1, work);
+    else
+        work(0, chunks, 0);
+
+    // ǰĴ
+    for (int c = 0; c < chunks; ++c)
+        if (err[c].what)
+            throw std::runtime_error(std::string("edge list: ") + err[c].what + " at byte " +
+                                     std::to_string(err[c].pos));
+
+    std::vector<size_t> at(chunks + 1, 0);
+    int mx = -1;
+    for (int c = 0; c < chunks; ++c) {
+        at[c + 1] = at[c] + part[c].size();
+        mx = std::max(mx, maxId[c]);
+    }
+    std::vector<GraphEdge> edges(at[chunks]);
+    auto merge = [&](size_t b, size_t e, int) {
+        for (size_t c = b; c < e; ++c) {
+            std::copy(part[c].begin(), part[c].end(), edges.begin() + at[c]);
+            std::vector<GraphEdge>().swap(part[c]);
+        }
+    };
+    if (pool)
+        pool->parallelFor(chunks, 1, merge);
+    else
+        merge(0, chunks, 0);
+    if (vertexCount) *vertexCount = mx + 1;
+    return edges;
+}
+
+#endif
@@ -6,202 +6,9 @@
 #include <cstring>
 #include <unordered_set>
 
-using namespace std;
-
-// ͼݽṹڽӾʾ
-class Graph {
-public:
-    vector<vector<int>> adjMatrix;
-    int V; // 
-
-    Graph(int vertices) {
-        V = vertices;
-        adjMatrix.resize(V, vector<int>(V, 0)); // ʼڽӾ
-    }
-
-    // ӱ
-    void addEdge(int u, int v, int weight = 1) {
-        adjMatrix[u][v] = weight;
-        adjMatrix[v][u] = weight;  // ͼ÷
-    }
-
-    // ڽӾ
-    void printAdjMatrix() {
-        for (int i = 0; i < V; i++) {
-            for (int j = 0; j < V; j++) {
-                cout << adjMatrix[i][j] << " ";
-            }
-            cout << endl;
-        }
-    }
-
-    //  BFS
-    void BFS(int start) {
-        vector<bool> visited(V, false);
-        queue<int> q;
-
-        visited[start] = true;
-        q.push(start);
-
-        while (!q.empty()) {
-            int node = q.front();
-            cout << node << " ";
-            q.pop();
-
-            for (int i = 0; i < V; i++) {
-                if (adjMatrix[node][i] != 0 && !visited[i]) { // бδ
-                    visited[i] = true;
-                    q.push(i);
-                }
-            }
-        }
-        cout << endl;
-    }
-
-    //  DFS
-    void DFS(int start) {
-        vector<bool> visited(V, false);
-        stack<int> s;
-
-        s.push(start);
-
-        while (!s.empty()) {
-            int node = s.top();
-            s.pop();
-
-            if (!visited[node]) {
-                visited[node] = true;
-                cout << node << " ";
-            }
-
-            for (int i = 0; i < V; i++) {
-                if (adjMatrix[node][i] != 0 && !visited[i]) {
-                    s.push(i);
-                }
-            }
-        }
-        cout << endl;
-    }
-
-    // Dijkstra 㷨·
-    void dijkstra(int start) {
-        vector<int> dist(V, INT_MAX);
-        vector<bool> visited(V, false);
-        dist[start] = 0;
-
-        for (int i = 0; i < V - 1; i++) {
-            int u = -1;
-            for (int j = 0; j < V; j++) {
-                if (!visited[j] && (u == -1 || dist[j] < dist[u])) {
-                    u = j;
-                }
-            }
+#include "graph.h"
 
-            visited[u] = true;
-
-            for (int v = 0; v < V; v++) {
-                if (adjMatrix[u][v] != 0 && dist[u] + adjMatrix[u][v] < dist[v]) {
-                    dist[v] = dist[u] + adjMatrix[u][v];
-                }
-            }
-        }
-
-        // ·
-        for (int i = 0; i < V; i++) {
-            cout << "Distance from " << start << " to " << i << ": " << dist[i] << endl;
-        }
-    }
-
-    // Сʹ Prim 㷨
-    void prim() {
-        vector<int> parent(V, -1);
-        vector<int> key(V, INT_MAX);
-        vector<bool> inMST(V, false);
-
-        key[0] = 0;
-        for (int count = 0; count < V - 1; count++) {
-            int u = -1;
-            for (int v = 0; v < V; v++) {
-                if (!inMST[v] && (u == -1 || key[v] < key[u])) {
-                    u = v;
-                }
-            }
-
-            inMST[u] = true;
-
-            for (int v = 0; v < V; v++) {
-                if (adjMatrix[u][v] != 0 && !inMST[v] && adjMatrix[u][v] < key[v]) {
-                    key[v] = adjMatrix[u][v];
-                    parent[v] = u;
-                }
-            }
-        }
-
-        // С
-        cout << "Edge \t Weight" << endl;
-        for (int i = 1; i < V; i++) {
-            cout << parent[i] << " - " << i << " \t " << adjMatrix[i][parent[i]] << endl;
-        }
-    }
-
-    // ˫ͨ
-    void tarjanBCC(int u, int disc[], int low[], stack<int>& st, vector<bool>& inStack, vector<unordered_set<int>>& bcc, int& time) {
-        disc[u] = low[u] = ++time;
-        st.push(u);
-        inStack[u] = true;
-
-        for (int v = 0; v < V; v++) {
-            if (adjMatrix[u][v] != 0) {
-                if (disc[v] == -1) {
-                    tarjanBCC(v, disc, low, st, inStack, bcc, time);
-                    low[u] = min(low[u], low[v]);
-                }
-                else if (inStack[v]) {
-                    low[u] = min(low[u], disc[v]);
-                }
-            }
-        }
-
-        if (low[u] == disc[u]) {
-            unordered_set<int> component;
-            while (st.top() != u) {
-                int v = st.top();
-                component.insert(v);
-                inStack[v] = false;
-                st.pop();
-            }
-            component.insert(u);
-            inStack[u] = false;
-            st.pop();
-            bcc.push_back(component);
-        }
-    }
-
-    // ú㲢˫ͨ
-    void findBCC() {
-        int disc[V], low[V];
-        vector<bool> inStack(V, false);
-        stack<int> st;
-        vector<unordered_set<int>> bcc;
-        int time = -1;
-
-        fill(disc, disc + V, -1);
-
-        for (int i = 0; i < V; i++) {
-            if (disc[i] == -1) {
-                tarjanBCC(i, disc, low, st, inStack, bcc, time);
-            }
-        }
-
-        cout << "Biconnected components:" << endl;
-        for (auto& component : bcc) {
-            for (int node : component) {
-                cout << node << " ";
-            }
-            cout << endl;
-        }
-    }
-};
+using namespace std;
 
 int main() {
     // ͼ1
@@ -0,0 +1,178 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <stack>
+#include <climits>
+#include <cstring>
+#include <unordered_set>
+
+#include "biconnected.h"
+
+using namespace std;
+
+// ͼݽṹڽӾʾ
+class Graph {
+public:
+    vector<vector<int>> adjMatrix;
+    int V; // 
+
+    Graph(int vertices) {
+        V = vertices;
+        adjMatrix.resize(V, vector<int>(V, 0)); // ʼڽӾ
+    }
+
+    // ӱ
+    void addEdge(int u, int v, int weight = 1) {
+        adjMatrix[u][v] = weight;
+        adjMatrix[v][u] = weight;  // ͼ÷
+    }
+
+    // ڽӾ
+    void printAdjMatrix() {
+        for (int i = 0; i < V; i++) {
+            for (int j = 0; j < V; j++) {
+                cout << adjMatrix[i][j] << " ";
+            }
+            cout << endl;
+        }
+    }
+
+    //  BFS
+    void BFS(int start) {
+        vector<bool> visited(V, false);
+        queue<int> q;
+
+        visited[start] = true;
+        q.push(start);
+
+        while (!q.empty()) {
+            int node = q.front();
+            cout << node << " ";
+            q.pop();
+
+            for (int i = 0; i < V; i++) {
+                if (adjMatrix[node][i] != 0 && !visited[i]) { // бδ
+                    visited[i] = true;
+                    q.push(i);
+                }
+            }
+        }
+        cout << endl;
+    }
+
+    //  DFS
+    void DFS(int start) {
+        vector<bool> visited(V, false);
+        stack<int> s;
+
+        s.push(start);
+
+        while (!s.empty()) {
+            int node = s.top();
+            s.pop();
+
+            if (!visited[node]) {
+                visited[node] = true;
+                cout << node << " ";
+            }
+
+            for (int i = 0; i < V; i++) {
+                if (adjMatrix[node][i] != 0 && !visited[i]) {
+                    s.push(i);
+                }
+            }
+        }
+        cout << endl;
+    }
+
+    // Dijkstra 㷨·
+    void dijkstra(int start) {
+        vector<int> dist(V, INT_MAX);
+        vector<bool> visited(V, false);
+        dist[start] = 0;
+
+        for (int i = 0; i < V - 1; i++) {
+            int u = -1;
+            for (int j = 0; j < V; j++) {
+                if (!visited[j] && (u == -1 || dist[j] < dist[u])) {
+                    u = j;
+                }
+            }
+
+            visited[u] = true;
+            if (dist[u] == INT_MAX) break;  // ʣµĶɴټӱȨ
+
+            for (int v = 0; v < V; v++) {
+                if (adjMatrix[u][v] != 0 && dist[u] + adjMatrix[u][v] < dist[v]) {
+                    dist[v] = dist[u] + adjMatrix[u][v];
+                }
+            }
+        }
+
+        // ·
+        for (int i = 0; i < V; i++) {
+            cout << "Distance from " << start << " to " << i << ": " << dist[i] << endl;
+        }
+    }
+
+    // Сʹ Prim 㷨
+    void prim() {
+        vector<int> parent(V, -1);
+        vector<int> key(V, INT_MAX);
+        vector<bool> inMST(V, false);
+
+        key[0] = 0;
+        for (int count = 0; count < V - 1; count++) {
+            int u = -1;
+            for (int v = 0; v < V; v++) {
+                if (!inMST[v] && (u == -1 || key[v] < key[u])) {
+                    u = v;
+                }
+            }
+
+            inMST[u] = true;
+
+            for (int v = 0; v < V; v++) {
+                if (adjMatrix[u][v] != 0 && !inMST[v] && adjMatrix[u][v] < key[v]) {
+                    key[v] = adjMatrix[u][v];
+                    parent[v] = u;
+                }
+            }
+        }
+
+        // С
+        cout << "Edge \t Weight" << endl;
+        for (int i = 1; i < V; i++) {
+            if (parent[i] == -1) continue;  // ͨͼĸ
+            cout << parent[i] << " - " << i << " \t " << adjMatrix[i][parent[i]] << endl;
+        }
+    }
+
+    // 㲢˫ͨÿ䶥㣩
+    void findBCC() {
+        vector<GraphEdge> edges;
+        for (int u = 0; u < V; u++) {
+            for (int v = u + 1; v < V; v++) {
+                if (adjMatrix[u][v] != 0) {
+                    GraphEdge e = {u, v, adjMatrix[u][v]};
+                    edges.push_back(e);
+                }
+            }
+        }
+        BiconnectedComponents bcc(CSRGraph(V, edges));
+
+        cout << "Biconnected components:" << endl;
+        for (int c = 0; c < bcc.componentCount(); c++) {
+            vector<int> component = bcc.componentVertices(c);
+            for (int node : component) {
+                cout << node << " ";
+            }
+            cout << endl;
+        }
+    }
+};
+
+#endif
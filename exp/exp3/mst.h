@@ -0,0 +1,258 @@
+#ifndef MST_H
+#define MST_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_graph.h"
+#include "shortest_path.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    Сɭ
+    㷨ɭֵı߱ÿͨһ
+     = V - ͨ
+====================================================*/
+
+// 鼯Ⱥϲ + ·ѹ
+class DisjointSet {
+public:
+    explicit DisjointSet(int n = 0) {
+        reset(n);
+    }
+
+    void reset(int n) {
+        parent.resize(n);
+        rank.assign(n, 0);
+        for (int i = 0; i < n; ++i) parent[i] = i;
+    }
+
+    int find(int x) {
+        int r = x;
+        while (parent[r] != r) r = parent[r];
+        while (parent[x] != r) {
+            int next = parent[x];
+            parent[x] = r;
+            x = next;
+        }
+        return r;
+    }
+
+    // ϲɹ trueͬһϷ false
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (rank[a] < rank[b]) std::swap(a, b);
+        parent[b] = a;
+        if (rank[a] == rank[b]) rank[a]++;
+        return true;
+    }
+
+private:
+    std::vector<int> parent;
+    std::vector<unsigned char> rank;
+};
+
+/*----------------------------------------------------
+    鼯parent Ϊԭ
+    find  CAS ·۰룻unite ܰѱСĸҵĸ£
+    CAS ʧ˵ѱ仯 find 
+----------------------------------------------------*/
+class AtomicDisjointSet {
+public:
+    explicit AtomicDisjointSet(int n) : parent(new std::atomic<int>[n]) {
+        for (int i = 0; i < n; ++i) parent[i].store(i, std::memory_order_relaxed);
+    }
+
+    int find(int x) {
+        for (;;) {
+            int p = parent[x].load(std::memory_order_acquire);
+            if (p == x) return x;
+            int gp = parent[p].load(std::memory_order_acquire);
+            if (gp == p) return p;
+            parent[x].compare_exchange_weak(p, gp, std::memory_order_acq_rel);
+            x = gp;
+        }
+    }
+
+    bool unite(int a, int b) {
+        for (;;) {
+            a = find(a);
+            b = find(b);
+            if (a == b) return false;
+            if (a > b) std::swap(a, b);
+            int expect = a;
+            if (parent[a].compare_exchange_strong(expect, b, std::memory_order_acq_rel)) return true;
+        }
+    }
+
+private:
+    std::unique_ptr<std::atomic<int>[]> parent;
+};
+
+// ߵȫ(Ȩֵ, С˵, ϴ˵)֤ȨʱҲȷ
+inline bool mstEdgeLess(const GraphEdge& a, const GraphEdge& b) {
+    if (a.w != b.w) return a.w < b.w;
+    int a0 = std::min(a.u, a.v), b0 = std::min(b.u, b.v);
+    if (a0 != b0) return a0 < b0;
+    return std::max(a.u, a.v) < std::max(b.u, b.v);
+}
+
+// 򣺸߳һΣ鲢
+inline void parallelSortEdges(std::vector<GraphEdge>& edges, MySTL::ThreadPool* pool) {
+    size_t n = edges.size();
+    int parts = pool ? pool->size() : 1;
+    if (parts <= 1 || n < ((size_t)1 << 16)) {
+        std::sort(edges.begin(), edges.end(), mstEdgeLess);
+        return;
+    }
+    std::vector<size_t> cut(parts + 1);
+    for (int p = 0; p <= parts; ++p) cut[p] = n * p / parts;
+    pool->run([&](int tid) {
+        std::sort(edges.begin() + cut[tid], edges.begin() + cut[tid + 1], mstEdgeLess);
+    });
+    std::vector<GraphEdge> buf(n);
+    std::vector<GraphEdge>* src = &edges;
+    std::vector<GraphEdge>* dst = &buf;
+    for (size_t width = 1; width < (size_t)parts; width *= 2) {
+        size_t groups = (parts + 2 * width - 1) / (2 * width);
+        pool->parallelFor(groups, 1, [&](size_t b, size_t e, int) {
+            for (size_t gi = b; gi < e; ++gi) {
+                size_t lo = cut[std::min((size_t)parts, gi * 2 * width)];
+                size_t mid = cut[std::min((size_t)parts, gi * 2 * width + width)];
+                size_t hi = cut[std::min((size_t)parts, gi * 2 * width + 2 * width)];
+                std::merge(src->begin() + lo, src->begin() + mid, src->begin() + mid, src->begin() + hi,
+                           dst->begin() + lo, mstEdgeLess);
+            }
+        });
+        std::swap(src, dst);
+    }
+    if (src != &edges) edges.swap(buf);
+}
+
+/*----------------------------------------------------
+    Prim decrease-key Ĳѣÿһ
+----------------------------------------------------*/
+inline std::vector<GraphEdge> primMST(const CSRGraph& g) {
+    std::vector<GraphEdge> forest;
+    std::vector<long long> key(g.V, CSR_INF);
+    std::vector<int> parent(g.V, -1);
+    std::vector<char> inTree(g.V, 0);
+    IndexedHeap<4> heap(g.V);
+    for (int r = 0; r < g.V; ++r) {
+        if (inTree[r]) continue;
+        key[r] = 0;
+        heap.push(r, 0);
+        while (!heap.empty()) {
+            int u = heap.pop().second;
+            inTree[u] = 1;
+            if (parent[u] >= 0) {
+                GraphEdge e = {parent[u], u, (int)key[u]};
+                forest.push_back(e);
+            }
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                if (!inTree[v] && g.weight[k] < key[v]) {
+                    key[v] = g.weight[k];
+                    parent[v] = u;
+                    heap.push(v, key[v]);
+                }
+            }
+        }
+    }
+    return forest;
+}
+
+/*----------------------------------------------------
+    Kruskal߱˳ɨ裬鼯л
+    edges ֵ룬Ҫԭʱ std::move
+----------------------------------------------------*/
+inline std::vector<GraphEdge> kruskalMST(int V, std::vector<GraphEdge> edges, MySTL::ThreadPool* pool = nullptr) {
+    for (size_t i = 0; i < edges.size(); ++i)
+        if ((unsigned)edges[i].u >= (unsigned)V || (unsigned)edges[i].v >= (unsigned)V)
+            throw std::invalid_argument("kruskalMST: vertex id out of range");
+    parallelSortEdges(edges, pool);
+    DisjointSet ds(V);
+    std::vector<GraphEdge> forest;
+    for (size_t i = 0; i < edges.size() && forest.size() + 1 < (size_t)V; ++i)
+        if (ds.unite(edges[i].u, edges[i].v)) forest.push_back(edges[i]);
+    return forest;
+}
+
+/*----------------------------------------------------
+     Boruvkaÿָѡĳ
+     (Ȩֵ, ߺ) ԭȡС֤޻
+    鼯кϲڲıִ޳
+----------------------------------------------------*/
+inline std::vector<GraphEdge> boruvkaMST(int V, const std::vector<GraphEdge>& edges,
+                                         MySTL::ThreadPool* pool = nullptr) {
+    if (edges.size() >= ((size_t)1 << 32)) throw std::length_error("boruvkaMST: too many edges");
+    for (size_t i = 0; i < edges.size(); ++i)
+        if ((unsigned)edges[i].u >= (unsigned)V || (unsigned)edges[i].v >= (unsigned)V)
+            throw std::invalid_argument("boruvkaMST: vertex id out of range");
+    MySTL::ThreadPool single(1);
+    MySTL::ThreadPool& tp = pool ? *pool : single;
+    int T = tp.size();
+    const uint64_t NONE = ~0ULL;
+    const size_t grain = 1 << 14;
+
+    AtomicDisjointSet ds(V);
+    std::unique_ptr<std::atomic<uint64_t>[]> best(new std::atomic<uint64_t>[V]);
+    for (int v = 0; v < V; ++v) best[v].store(NONE, std::memory_order_relaxed);
+    std::vector<uint32_t> alive(edges.size()), keep(edges.size());
+    for (size_t i = 0; i < alive.size(); ++i) alive[i] = (uint32_t)i;
+    std::vector<std::vector<GraphEdge> > picked(T);
+    std::vector<std::vector<uint32_t> > kept(T);
+    std::vector<GraphEdge> forest;
+
+    while (!alive.empty()) {
+        // 1. ߣͨı޳
+        tp.parallelFor(alive.size(), grain, [&](size_t b, size_t e, int tid) {
+            for (size_t i = b; i < e; ++i) {
+                const GraphEdge& g = edges[alive[i]];
+                int ru = ds.find(g.u), rv = ds.find(g.v);
+                if (ru == rv) continue;
+                kept[tid].push_back(alive[i]);
+                uint64_t key = ((uint64_t)((uint32_t)g.w ^ 0x80000000u) << 32) | alive[i];
+                int ends[2] = {ru, rv};
+                for (int s = 0; s < 2; ++s) {
+                    uint64_t old = best[ends[s]].load(std::memory_order_relaxed);
+                    while (key < old && !best[ends[s]].compare_exchange_weak(old, key, std::memory_order_relaxed)) {}
+                }
+            }
+        });
+
+        // 2. ϲͬһ߿ܱ˵ķѡУunite ֻɹһ
+        tp.parallelFor((size_t)V, grain, [&](size_t b, size_t e, int tid) {
+            for (size_t v = b; v < e; ++v) {
+                uint64_t key = best[v].load(std::memory_order_relaxed);
+                if (key == NONE) continue;
+                best[v].store(NONE, std::memory_order_relaxed);
+                const GraphEdge& g = edges[(uint32_t)key];
+                if (ds.unite(g.u, g.v)) picked[tid].push_back(g);
+            }
+        });
+
+        size_t merged = 0, left = 0;
+        for (int t = 0; t < T; ++t) {
+            merged += picked[t].size();
+            forest.insert(forest.end(), picked[t].begin(), picked[t].end());
+            picked[t].clear();
+            std::copy(kept[t].begin(), kept[t].end(), keep.begin() + left);
+            left += kept[t].size();
+            kept[t].clear();
+        }
+        keep.resize(left);
+        alive.swap(keep);
+        keep.resize(alive.size());
+        if (merged == 0) break;
+    }
+    return forest;
+}
+
+#endif
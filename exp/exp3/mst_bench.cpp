@@ -0,0 +1,100 @@
+#include <iostream>
+#include <cstdio>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <thread>
+
+#include "mst.h"
+
+using namespace std;
+
+/*====================================================
+    СɭֲԣV = 10^6E = 10^7
+      CSR Prim : CSRGraph::primԶ
+      Prim     : primMSTĲ + decrease-key
+      Kruskal  :  + 鼯
+      Boruvka  : ѡ + 鼯
+    ⺬Ͷķͨͼ
+    룺g++ -O2 -pthread mst_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// parts 飬ÿռ V / parts 㣻 isolated 
+static vector<GraphEdge> randomForestGraph(int V, size_t E, int parts, int isolated, unsigned seed) {
+    mt19937_64 rng(seed);
+    int per = (V - isolated) / parts;
+    vector<GraphEdge> edges;
+    edges.reserve(E);
+    while (edges.size() < E) {
+        int p = (int)(rng() % parts);
+        GraphEdge e = {p * per + (int)(rng() % per), p * per + (int)(rng() % per), (int)(rng() % 1000000) + 1};
+        if (e.u != e.v) edges.push_back(e);
+    }
+    return edges;
+}
+
+static long long totalWeight(const vector<GraphEdge>& f) {
+    long long s = 0;
+    for (size_t i = 0; i < f.size(); ++i) s += f[i].w;
+    return s;
+}
+
+// ɭ֣޻ͨԭͼһ
+static bool isSpanningForest(int V, const vector<GraphEdge>& edges, const vector<GraphEdge>& f) {
+    DisjointSet a(V), b(V);
+    for (size_t i = 0; i < f.size(); ++i)
+        if (!a.unite(f[i].u, f[i].v)) return false;
+    size_t comps = V;
+    for (size_t i = 0; i < edges.size(); ++i) comps -= b.unite(edges[i].u, edges[i].v);
+    return f.size() == V - comps;
+}
+
+static void runCase(const char* name, int V, size_t E, int parts, int isolated) {
+    vector<GraphEdge> edges = randomForestGraph(V, E, parts, isolated, 29);
+    CSRGraph g(V, edges);
+    printf("\n--- %s  V = %d  E = %zu ---\n", name, V, E);
+
+    vector<int> parent;
+    double t0 = timeMs([&] { parent = g.prim(); });
+    long long ref = 0;
+    size_t refEdges = 0;
+    for (int v = 0; v < V; ++v) {
+        if (parent[v] < 0) continue;
+        int best = INT_MAX;
+        for (uint64_t k = g.offsets[v]; k < g.offsets[v + 1]; ++k)
+            if (g.adj[k] == parent[v]) best = min(best, g.weight[k]);
+        ref += best;
+        refEdges++;
+    }
+    printf("CSR Prim          %8.1f ms  Ȩ %lld   %zu\n", t0, ref, refEdges);
+
+    vector<GraphEdge> f;
+    double t1 = timeMs([&] { f = primMST(g); });
+    printf("Prim Ĳ       %8.1f ms  Ȩ %lld   %zu  %s\n", t1, totalWeight(f), f.size(),
+           totalWeight(f) == ref && isSpanningForest(V, edges, f) ? "OK" : "һ");
+
+    for (int t = 1; t <= 4; t *= 2) {
+        MySTL::ThreadPool pool(t);
+        double tk = timeMs([&] { f = kruskalMST(V, edges, &pool); });
+        bool ok = totalWeight(f) == ref && isSpanningForest(V, edges, f);
+        printf("Kruskal  %d ߳   %8.1f ms  Ȩ %lld   %zu  %s\n", t, tk, totalWeight(f), f.size(), ok ? "OK" : "һ");
+        double tb = timeMs([&] { f = boruvkaMST(V, edges, &pool); });
+        ok = totalWeight(f) == ref && isSpanningForest(V, edges, f);
+        printf("Boruvka  %d ߳   %8.1f ms  Ȩ %lld   %zu  %s\n", t, tb, totalWeight(f), f.size(), ok ? "OK" : "һ");
+    }
+}
+
+int main() {
+    cout << "==== СɭֲԣӲ߳ " << thread::hardware_concurrency() << "====" << endl;
+    runCase("ͨͼ", 1000000, 10000000, 1, 0);
+    runCase("8  + 1000 ", 1000000, 10000000, 8, 1000);
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+#include "p2p_query.h"
+
+using namespace std;
+
+/*====================================================
+    Եѯ²ԣ· + ɾ + ȨŶ
+      ShortestPath : ǰÿβѯλĶ㣩
+      bidir        : ˫ Dijkstra
+      A* ŷ      : ֱ߾Ϊ½
+      ALT-k        : k ·½
+    룺g++ -O2 -pthread p2p_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// W x H ڸ߳ 1Ȩ = 100 *  * [1, 1.5)ɾȥԼ 10% ı
+static vector<GraphEdge> roadGrid(int W, int H, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_real_distribution<double> jitter(1.0, 1.5);
+    vector<GraphEdge> edges;
+    for (int y = 0; y < H; ++y)
+        for (int x = 0; x < W; ++x) {
+            int v = y * W + x;
+            if (x + 1 < W && rng() % 10) {
+                GraphEdge e = {v, v + 1, (int)(100 * jitter(rng))};
+                edges.push_back(e);
+            }
+            if (y + 1 < H && rng() % 10) {
+                GraphEdge e = {v, v + W, (int)(100 * jitter(rng))};
+                edges.push_back(e);
+            }
+        }
+    return edges;
+}
+
+struct Stat {
+    double ms;
+    size_t settled;
+    bool ok;
+};
+
+int main() {
+    const int W = 500, H = 500, Q = 300;
+    const int V = W * H;
+    CSRGraph g(V, roadGrid(W, H, 2025));
+    printf("==== Եѯ   %dx%d  V = %d   %llu  ѯ %d  ====\n", W, H, V,
+           (unsigned long long)g.arcCount(), Q);
+
+    mt19937 rng(7);
+    vector<pair<int, int> > qs(Q);
+    for (int i = 0; i < Q; ++i) qs[i] = make_pair((int)(rng() % V), (int)(rng() % V));
+
+    // մ𰸣 Dijkstra
+    vector<long long> ref(Q);
+    ShortestPath sp(g);
+    double tRef = timeMs([&] {
+        for (int i = 0; i < Q; ++i) {
+            sp.run(qs[i].first, qs[i].second);
+            ref[i] = sp.distance(qs[i].second);
+        }
+    });
+    printf("%-20s %8.3f ms/  %8.0f /\n", "ShortestPath ǰ", tRef / Q, Q * 1000.0 / tRef);
+
+    ALTLandmarks lm8, lm16;
+    double tb8 = timeMs([&] { lm8.build(g, 8); });
+    double tb16 = timeMs([&] { lm16.build(g, 16); });
+    printf("·Ԥ8  %.1f ms16  %.1f ms\n", tb8, tb16);
+
+    P2PQuery q(g, &lm8), q16(g, &lm16);
+    const char* names[] = {"P2P dijkstra", "P2P bidir", "P2P A* ŷ", "P2P ALT-8", "P2P ALT-16"};
+    for (int m = 0; m < 5; ++m) {
+        Stat st = {0, 0, true};
+        st.ms = timeMs([&] {
+            for (int i = 0; i < Q; ++i) {
+                int s = qs[i].first, t = qs[i].second;
+                long long d;
+                if (m == 0) d = q.dijkstra(s, t);
+                else if (m == 1) d = q.bidirectional(s, t);
+                else if (m == 2) {
+                    int tx = t % W, ty = t / W;
+                    d = q.astar(s, t, [&](int v) {
+                        double dx = v % W - tx, dy = v / W - ty;
+                        return (long long)(100 * sqrt(dx * dx + dy * dy));
+                    });
+                } else if (m == 3) d = q.alt(s, t);
+                else d = q16.alt(s, t);
+                st.settled += m == 4 ? q16.settledCount() : q.settledCount();
+                if (d != ref[i]) st.ok = false;
+            }
+        });
+        // ·ڶбұȨ֮͵ھ
+        P2PQuery& qq = m == 4 ? q16 : q;
+        vector<int> p = qq.path();
+        long long len = 0;
+        for (size_t j = 1; j < p.size(); ++j) {
+            int best = -1;
+            for (uint64_t k = g.offsets[p[j - 1]]; k < g.offsets[p[j - 1] + 1]; ++k)
+                if (g.adj[k] == p[j] && (best < 0 || g.weight[k] < best)) best = g.weight[k];
+            if (best < 0) st.ok = false;
+            len += best;
+        }
+        if (ref[Q - 1] != CSR_INF && len != ref[Q - 1]) st.ok = false;
+        printf("%-20s %8.3f ms/  %8.0f /  ƽ %7zu  (x%.1f)  %s\n", names[m], st.ms / Q,
+               Q * 1000.0 / st.ms, st.settled / Q, tRef / st.ms, st.ok ? "OK" : "һ");
+    }
+
+    // ÿ߳һѯ󣬹ͼ·
+    int T = max(1u, thread::hardware_concurrency());
+    MySTL::ThreadPool pool(T);
+    vector<int> bad(T, 0);
+    vector<unique_ptr<P2PQuery> > local(T);
+    for (int t = 0; t < T; ++t) local[t].reset(new P2PQuery(g, &lm16));
+    double tp = timeMs([&] {
+        pool.parallelFor(Q, 8, [&](size_t b, size_t e, int tid) {
+            for (size_t i = b; i < e; ++i)
+                if (local[tid]->alt(qs[i].first, qs[i].second) != ref[i]) bad[tid]++;
+        });
+    });
+    int badSum = 0;
+    for (int t = 0; t < T; ++t) badSum += bad[t];
+    printf("ALT-16 %d ̲߳     %8.0f /  %s\n", T, Q * 1000.0 / tp, badSum ? "һ" : "OK");
+    return 0;
+}
@@ -0,0 +1,236 @@
+#ifndef P2P_QUERY_H
+#define P2P_QUERY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.h"
+#include "shortest_path.h"
+
+/*====================================================
+    ALT ·꣺Ԥ·굽жľ룬
+    ǲʽ d(v,t) >= |d(L,t) - d(L,v)| õ A* ½
+    ·áԶ㡱ѡÿȡѡ·ԶĶ
+    ֻͼCSRGraph ĬϽֻͨ
+====================================================*/
+class ALTLandmarks {
+public:
+    ALTLandmarks() : k(0) {}
+
+    void build(const CSRGraph& g, int count, unsigned seed = 1) {
+        k = 0;
+        marks.clear();
+        dist.clear();
+        if (g.V == 0 || count <= 0) return;
+
+        ShortestPath sp(g);
+        std::mt19937 rng(seed);
+        sp.run((int)(rng() % g.V));
+        std::vector<long long> minD(sp.distances());
+        dist.assign((size_t)g.V * count, CSR_INF);
+        for (int i = 0; i < count; ++i) {
+            int far = -1;
+            for (int v = 0; v < g.V; ++v)
+                if (minD[v] != CSR_INF && (far < 0 || minD[v] > minD[far])) far = v;
+            if (far < 0 || (i > 0 && minD[far] == 0)) break;
+            sp.run(far);
+            for (int v = 0; v < g.V; ++v) {
+                long long d = sp.distance(v);
+                dist[(size_t)v * count + i] = d;
+                if (i == 0 || d < minD[v]) minD[v] = d;
+            }
+            marks.push_back(far);
+        }
+        // ʵѡ· countʵʸѹ
+        k = (int)marks.size();
+        if (k < count) {
+            for (int v = 0; v < g.V; ++v)
+                for (int i = 0; i < k; ++i) dist[(size_t)v * k + i] = dist[(size_t)v * count + i];
+            dist.resize((size_t)g.V * k);
+        }
+    }
+
+    int count() const {
+        return k;
+    }
+
+    const std::vector<int>& vertices() const {
+        return marks;
+    }
+
+    // d(v, t) ½
+    long long lowerBound(int v, int t) const {
+        const long long* a = &dist[(size_t)v * k];
+        const long long* b = &dist[(size_t)t * k];
+        long long h = 0;
+        for (int i = 0; i < k; ++i) {
+            if (a[i] == CSR_INF || b[i] == CSR_INF) continue;
+            long long d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+            if (d > h) h = d;
+        }
+        return h;
+    }
+
+private:
+    int k;
+    std::vector<int> marks;
+    std::vector<long long> dist;   // dist[v * k + i] = d(· i, v)
+};
+
+/*====================================================
+    Ե·ѯͼȨǸ
+    dist / pred / ѵȲѯֳУ
+    ÿβѯֻλϴĶ㣻
+    ̲߳ѯʱÿ߳øԵ P2PQuery·ɹ
+====================================================*/
+class P2PQuery {
+public:
+    explicit P2PQuery(const CSRGraph& graph, const ALTLandmarks* landmarks = nullptr)
+        : g(graph), lm(landmarks), meet(-1), settled(0) {
+        for (size_t k = 0; k < g.weight.size(); ++k)
+            if (g.weight[k] < 0) throw std::invalid_argument("P2PQuery: negative edge weight");
+        for (int side = 0; side < 2; ++side) {
+            dist[side].assign(g.V, CSR_INF);
+            pred[side].assign(g.V, -1);
+            done[side].assign(g.V, 0);
+            heap[side].resize(g.V);
+        }
+    }
+
+    //  Dijkstrat Ѽͣ
+    long long dijkstra(int s, int t) {
+        return astar(s, t, [](int) { return 0LL; });
+    }
+
+    /*------------------------------------------------
+        A*h(v)  d(v, t) ½磻
+        һµҲܵõȷѳѶѣ
+    ------------------------------------------------*/
+    template<typename H>
+    long long astar(int s, int t, H h) {
+        begin(s, t);
+        setDist(0, s, 0, -1);
+        heap[0].push(s, h(s));
+        while (!heap[0].empty()) {
+            int u = heap[0].pop().second;
+            done[0][u] = 1;
+            settled++;
+            if (u == t) {
+                meet = t;
+                return dist[0][t];
+            }
+            long long du = dist[0][u];
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                long long nd = du + g.weight[k];
+                if (nd < dist[0][v]) {
+                    setDist(0, v, nd, u);
+                    done[0][v] = 0;
+                    heap[0].push(v, nd + h(v));
+                }
+            }
+        }
+        return CSR_INF;
+    }
+
+    //  ALT ·½ A*
+    long long alt(int s, int t) {
+        if (!lm || lm->count() == 0) throw std::logic_error("P2PQuery: landmarks not built");
+        const ALTLandmarks& L = *lm;
+        return astar(s, t, [&](int v) { return L.lowerBound(v, t); });
+    }
+
+    /*------------------------------------------------
+        ˫ DijkstraչѶСһ࣬
+        mu Ϊ֪ s-t ·Ѷ֮ >= mu ʱֹͣ
+    ------------------------------------------------*/
+    long long bidirectional(int s, int t) {
+        begin(s, t);
+        setDist(0, s, 0, -1);
+        setDist(1, t, 0, -1);
+        if (s == t) {
+            meet = s;
+            return 0;
+        }
+        heap[0].push(s, 0);
+        heap[1].push(t, 0);
+        long long mu = CSR_INF;
+        while (!heap[0].empty() && !heap[1].empty()) {
+            long long f = heap[0].topKey(), b = heap[1].topKey();
+            if (mu != CSR_INF && f + b >= mu) break;
+            int side = f <= b ? 0 : 1;
+            int u = heap[side].pop().second;
+            done[side][u] = 1;
+            settled++;
+            long long du = dist[side][u];
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                long long nd = du + g.weight[k];
+                if (nd < dist[side][v]) {
+                    setDist(side, v, nd, u);
+                    heap[side].push(v, nd);
+                    if (dist[1 - side][v] != CSR_INF && nd + dist[1 - side][v] < mu) {
+                        mu = nd + dist[1 - side][v];
+                        meet = v;
+                    }
+                }
+            }
+        }
+        return mu;
+    }
+
+    // һβѯ·s  t ĶУɴΪ
+    std::vector<int> path() const {
+        std::vector<int> p;
+        if (meet < 0) return p;
+        for (int v = meet; v != -1; v = pred[0][v]) p.push_back(v);
+        std::reverse(p.begin(), p.end());
+        for (int v = pred[1][meet]; v != -1; v = pred[1][v]) p.push_back(v);
+        return p;
+    }
+
+    // һβѯѵĶ
+    size_t settledCount() const {
+        return settled;
+    }
+
+private:
+    const CSRGraph& g;
+    const ALTLandmarks* lm;
+    std::vector<long long> dist[2];   // 0 Ϊ1 Ϊ
+    std::vector<int> pred[2];
+    std::vector<char> done[2];
+    std::vector<int> touched[2];
+    IndexedHeap<4> heap[2];
+    int meet;
+    size_t settled;
+
+    void begin(int s, int t) {
+        if ((unsigned)s >= (unsigned)g.V || (unsigned)t >= (unsigned)g.V)
+            throw std::invalid_argument("P2PQuery: vertex out of range");
+        for (int side = 0; side < 2; ++side) {
+            for (size_t i = 0; i < touched[side].size(); ++i) {
+                int v = touched[side][i];
+                dist[side][v] = CSR_INF;
+                pred[side][v] = -1;
+                done[side][v] = 0;
+            }
+            touched[side].clear();
+            heap[side].clear();
+        }
+        meet = -1;
+        settled = 0;
+    }
+
+    void setDist(int side, int v, long long d, int p) {
+        if (dist[side][v] == CSR_INF) touched[side].push_back(v);
+        dist[side][v] = d;
+        pred[side][v] = p;
+    }
+};
+
+#endif
@@ -0,0 +1,232 @@
+#ifndef PARALLEL_BFS_H
+#define PARALLEL_BFS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../../MySTL/atomic_bitmap.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    зŻ BFSBeamer 2012
+    - Զ£ɨ赱ǰеĳߣ visited λͼ
+      testAndSet ռ¶㣬߳ȷűضУ
+      ԭβָοһ
+    - Եϣÿδʶһڵǰλͼھӣ
+      ҵ̰ͣ߳ 64 λֶֻ㣬дλͼ
+    - лǰس mf > δ̽ mu / alpha ʱתԵϣ
+      ǰض nf < V / beta ʱתԶ
+    ҪͼCSRGraph ĬϽ
+====================================================*/
+class ParallelBFS {
+public:
+    explicit ParallelBFS(const CSRGraph& graph, MySTL::ThreadPool* threadPool = nullptr,
+                         int alphaParam = 15, int betaParam = 18)
+        : g(graph), pool(threadPool ? threadPool : &single), alpha(alphaParam), beta(betaParam),
+          single(1), visited(graph.V), front(new MySTL::AtomicBitmap(graph.V)),
+          next(new MySTL::AtomicBitmap(graph.V)),
+          topDownSteps(0), bottomUpSteps(0), depth(0), reached(0) {
+        parent.assign(g.V, -1);
+        level.assign(g.V, -1);
+        cur.resize(g.V);
+        nxt.resize(g.V);
+        local.resize(pool->size());
+        newEdges.resize(pool->size());
+    }
+
+    // alpha <= 0 ʱԶԶ
+    void run(int source) {
+        if ((unsigned)source >= (unsigned)g.V) throw std::invalid_argument("ParallelBFS: source out of range");
+        clear();
+        visited.set(source);
+        parent[source] = source;
+        level[source] = 0;
+        cur[0] = source;
+        size_t nf = 1;
+        uint64_t mf = g.offsets[source + 1] - g.offsets[source];
+        uint64_t mu = g.arcCount() - mf;
+        bool bottomUp = false;
+        reached = 1;
+
+        for (int d = 0; nf > 0; ++d) {
+            if (!bottomUp && alpha > 0 && mf > mu / alpha) {
+                queueToBitmap(nf);
+                bottomUp = true;
+            } else if (bottomUp && nf < (size_t)g.V / beta) {
+                nf = bitmapToQueue();
+                bottomUp = false;
+            }
+            if (bottomUp) {
+                nf = bottomUpStep(d, mf);
+                bottomUpSteps++;
+            } else {
+                nf = topDownStep(d, nf, mf);
+                topDownSteps++;
+            }
+            mu -= std::min(mu, mf);
+            reached += nf;
+            if (nf > 0) depth = d + 1;
+        }
+    }
+
+    // 㣬ԴΪɴΪ -1
+    const std::vector<int>& parents() const {
+        return parent;
+    }
+
+    // ţɴΪ -1
+    const std::vector<int>& levels() const {
+        return level;
+    }
+
+    int maxDepth() const {
+        return depth;
+    }
+
+    size_t reachedCount() const {
+        return reached;
+    }
+
+    int topDownCount() const {
+        return topDownSteps;
+    }
+
+    int bottomUpCount() const {
+        return bottomUpSteps;
+    }
+
+private:
+    const CSRGraph& g;
+    MySTL::ThreadPool* pool;
+    int alpha, beta;
+    MySTL::ThreadPool single;
+    MySTL::AtomicBitmap visited;
+    std::unique_ptr<MySTL::AtomicBitmap> front, next;   // Եʱĵǰ / һλͼ
+    std::vector<int> parent, level;
+    std::vector<int> cur, nxt;                // Զʱĵǰ / һ
+    std::vector<std::vector<int> > local;     // ÿ̵߳ıض
+    std::vector<uint64_t> newEdges;           // ÿ߳¶Ķ
+    std::atomic<size_t> tail;
+    int topDownSteps, bottomUpSteps, depth;
+    size_t reached;
+
+    void clear() {
+        visited.reset(pool);
+        pool->parallelFor((size_t)g.V, 1 << 16, [&](size_t b, size_t e, int) {
+            std::fill(parent.begin() + b, parent.begin() + e, -1);
+            std::fill(level.begin() + b, level.begin() + e, -1);
+        });
+        topDownSteps = bottomUpSteps = depth = 0;
+    }
+
+    // ضβ nxt
+    void flush(std::vector<int>& q) {
+        if (q.empty()) return;
+        size_t at = tail.fetch_add(q.size(), std::memory_order_relaxed);
+        std::copy(q.begin(), q.end(), nxt.begin() + at);
+        q.clear();
+    }
+
+    size_t topDownStep(int d, size_t nf, uint64_t& mf) {
+        tail.store(0);
+        std::fill(newEdges.begin(), newEdges.end(), 0);
+        pool->parallelFor(nf, 64, [&](size_t b, size_t e, int tid) {
+            std::vector<int>& q = local[tid];
+            uint64_t edges = 0;
+            for (size_t i = b; i < e; ++i) {
+                int u = cur[i];
+                for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                    int v = g.adj[k];
+                    if (visited.testAndSet(v)) continue;
+                    parent[v] = u;
+                    level[v] = d + 1;
+                    edges += g.offsets[v + 1] - g.offsets[v];
+                    q.push_back(v);
+                    if (q.size() >= 4096) flush(q);
+                }
+            }
+            flush(q);
+            newEdges[tid] += edges;
+        });
+        cur.swap(nxt);
+        mf = 0;
+        for (size_t t = 0; t < newEdges.size(); ++t) mf += newEdges[t];
+        return tail.load();
+    }
+
+    size_t bottomUpStep(int d, uint64_t& mf) {
+        next->reset(pool);
+        std::vector<size_t> found(pool->size(), 0);
+        std::fill(newEdges.begin(), newEdges.end(), 0);
+        size_t nwords = visited.wordCount();
+        pool->parallelFor(nwords, 256, [&](size_t b, size_t e, int tid) {
+            uint64_t edges = 0;
+            size_t cnt = 0;
+            for (size_t w = b; w < e; ++w) {
+                uint64_t todo = ~visited.loadWord(w);
+                if (w == nwords - 1 && (g.V & 63)) todo &= (1ULL << (g.V & 63)) - 1;
+                uint64_t gained = 0;
+                while (todo) {
+                    int bit = MySTL::ctz64(todo);
+                    todo &= todo - 1;
+                    int v = (int)(w * 64 + bit);
+                    for (uint64_t k = g.offsets[v]; k < g.offsets[v + 1]; ++k) {
+                        int u = g.adj[k];
+                        if (!front->test(u)) continue;
+                        parent[v] = u;
+                        level[v] = d + 1;
+                        gained |= 1ULL << bit;
+                        edges += g.offsets[v + 1] - g.offsets[v];
+                        cnt++;
+                        break;
+                    }
+                }
+                if (gained) {
+                    next->fetchOr(w, gained);
+                    visited.fetchOr(w, gained);
+                }
+            }
+            newEdges[tid] += edges;
+            found[tid] += cnt;
+        });
+        front.swap(next);
+        size_t nf = 0;
+        mf = 0;
+        for (size_t t = 0; t < found.size(); ++t) {
+            nf += found[t];
+            mf += newEdges[t];
+        }
+        return nf;
+    }
+
+    void queueToBitmap(size_t nf) {
+        front->reset(pool);
+        pool->parallelFor(nf, 1 << 12, [&](size_t b, size_t e, int) {
+            for (size_t i = b; i < e; ++i) front->set(cur[i]);
+        });
+    }
+
+    size_t bitmapToQueue() {
+        tail.store(0);
+        pool->parallelFor(front->wordCount(), 1 << 10, [&](size_t b, size_t e, int tid) {
+            std::vector<int>& q = local[tid];
+            for (size_t w = b; w < e; ++w) {
+                uint64_t x = front->loadWord(w);
+                while (x) {
+                    q.push_back((int)(w * 64 + MySTL::ctz64(x)));
+                    x &= x - 1;
+                }
+            }
+            flush(q);
+        });
+        cur.swap(nxt);
+        return tail.load();
+    }
+};
+
+#endif
@@ -0,0 +1,268 @@
+#ifndef REORDER_H
+#define REORDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    رţ߱ʱķôֲԣ
+      rcmOrder       :  Cuthill-McKeeڶС
+      degreeOrder    : Ƚȵ㶥㼯ǰ
+      communityOrder : ǩͬ
+    VertexOrder::apply õرźͼ
+    ͼĽ mapBack ϵлԭ
+====================================================*/
+
+class VertexOrder {
+public:
+    VertexOrder() {}
+
+    // newIdOf[v] Ϊԭ v ±ţ 0..n-1 
+    explicit VertexOrder(const std::vector<int>& newIdOf) : newId(newIdOf), oldId(newIdOf.size(), -1) {
+        int n = (int)newId.size();
+        for (int v = 0; v < n; ++v) {
+            int x = newId[v];
+            if (x < 0 || x >= n || oldId[x] >= 0) throw std::invalid_argument("VertexOrder: not a permutation");
+            oldId[x] = v;
+        }
+    }
+
+    // ±˳ԭ
+    static VertexOrder fromSequence(const std::vector<int>& seq) {
+        std::vector<int> id(seq.size(), -1);
+        for (size_t i = 0; i < seq.size(); ++i) {
+            if ((size_t)seq[i] >= seq.size()) throw std::invalid_argument("VertexOrder: not a permutation");
+            id[seq[i]] = (int)i;
+        }
+        return VertexOrder(id);
+    }
+
+    int size() const {
+        return (int)newId.size();
+    }
+
+    int toNew(int v) const {
+        return newId[v];
+    }
+
+    int toOld(int v) const {
+        return oldId[v];
+    }
+
+    /*------------------------------------------------
+        ±ؽ CSRÿ¶ڽӱԭź
+        ߱O(E log d)
+    ------------------------------------------------*/
+    CSRGraph apply(const CSRGraph& g, MySTL::ThreadPool* pool = nullptr) const {
+        if (g.V != size()) throw std::invalid_argument("VertexOrder: size mismatch");
+        CSRGraph h;
+        h.V = g.V;
+        h.offsets.assign((size_t)g.V + 1, 0);
+        for (int x = 0; x < g.V; ++x) h.offsets[x + 1] = h.offsets[x] + g.degree(oldId[x]);
+        h.adj.resize(g.arcCount());
+        h.weight.resize(g.arcCount());
+
+        MySTL::ThreadPool single(1);
+        MySTL::ThreadPool& tp = pool ? *pool : single;
+        tp.parallelFor((size_t)g.V, 4096, [&](size_t b, size_t e, int) {
+            std::vector<std::pair<int, int> > list;
+            for (size_t x = b; x < e; ++x) {
+                int u = oldId[x];
+                list.clear();
+                for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k)
+                    list.push_back(std::make_pair(newId[g.adj[k]], g.weight[k]));
+                std::sort(list.begin(), list.end());
+                uint64_t at = h.offsets[x];
+                for (size_t i = 0; i < list.size(); ++i) {
+                    h.adj[at + i] = list[i].first;
+                    h.weight[at + i] = list[i].second;
+                }
+            }
+        });
+        return h;
+    }
+
+    // ±±Ľ -> ԭ±꣨롢ŵȣ
+    template<typename T>
+    std::vector<T> mapBack(const std::vector<T>& r) const {
+        std::vector<T> out(r.size());
+        for (size_t x = 0; x < r.size(); ++x) out[oldId[x]] = r[x];
+        return out;
+    }
+
+    // ±ֵ±ţǰڵ㣩-1 ֲ
+    std::vector<int> mapBackVertices(const std::vector<int>& r) const {
+        std::vector<int> out(r.size());
+        for (size_t x = 0; x < r.size(); ++x) out[oldId[x]] = r[x] < 0 ? r[x] : oldId[r[x]];
+        return out;
+    }
+
+    // ±ŹɵУ˳·ԭ
+    std::vector<int> mapBackList(const std::vector<int>& seq) const {
+        std::vector<int> out(seq.size());
+        for (size_t i = 0; i < seq.size(); ++i) out[i] = oldId[seq[i]];
+        return out;
+    }
+
+private:
+    std::vector<int> newId;   // ԭ -> ±
+    std::vector<int> oldId;   // ± -> ԭ
+};
+
+/*----------------------------------------------------
+     Cuthill-McKee
+    ÿͨαΧ BFS ȡԶжСߣ
+    BFS ʱھӰӣ巴ת
+----------------------------------------------------*/
+inline VertexOrder rcmOrder(const CSRGraph& g) {
+    int V = g.V;
+    std::vector<int> seq;
+    seq.reserve(V);
+    std::vector<char> placed(V, 0);
+    std::vector<int> level(V, -1);
+    std::vector<int> probe;   // αΧõ BFS 
+
+    // һСĶ㣬depth ز
+    auto farthest = [&](int s, int& depth) {
+        probe.clear();
+        probe.push_back(s);
+        level[s] = 0;
+        for (size_t h = 0; h < probe.size(); ++h) {
+            int u = probe[h];
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                if (level[v] < 0) {
+                    level[v] = level[u] + 1;
+                    probe.push_back(v);
+                }
+            }
+        }
+        depth = level[probe.back()];
+        int best = probe.back();
+        for (size_t i = probe.size(); i-- > 0 && level[probe[i]] == depth;)
+            if (g.degree(probe[i]) < g.degree(best)) best = probe[i];
+        for (size_t i = 0; i < probe.size(); ++i) level[probe[i]] = -1;
+        return best;
+    };
+
+    // Ϊ·
+    std::vector<int> byDeg(V);
+    for (int v = 0; v < V; ++v) byDeg[v] = v;
+    std::stable_sort(byDeg.begin(), byDeg.end(), [&](int a, int b) { return g.degree(a) < g.degree(b); });
+
+    std::vector<int> nbrs;
+    for (int i = 0; i < V; ++i) {
+        int s = byDeg[i];
+        if (placed[s]) continue;
+        int depth = 0, next = 0;
+        int r = farthest(s, depth);
+        for (int t = 0; t < 4; ++t) {   // ־㹻ӽ
+            next = 0;
+            int c = farthest(r, next);
+            if (next <= depth) break;
+            depth = next;
+            r = c;
+        }
+
+        size_t head = seq.size();
+        seq.push_back(r);
+        placed[r] = 1;
+        for (; head < seq.size(); ++head) {
+            int u = seq[head];
+            nbrs.clear();
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                if (!placed[v]) {
+                    placed[v] = 1;
+                    nbrs.push_back(v);
+                }
+            }
+            std::stable_sort(nbrs.begin(), nbrs.end(), [&](int a, int b) { return g.degree(a) < g.degree(b); });
+            seq.insert(seq.end(), nbrs.begin(), nbrs.end());
+        }
+    }
+    std::reverse(seq.begin(), seq.end());
+    return VertexOrder::fromSequence(seq);
+}
+
+// Ƚͬȱԭ˳
+inline VertexOrder degreeOrder(const CSRGraph& g) {
+    std::vector<int> seq(g.V);
+    for (int v = 0; v < g.V; ++v) seq[v] = v;
+    std::stable_sort(seq.begin(), seq.end(), [&](int a, int b) { return g.degree(a) > g.degree(b); });
+    return VertexOrder::fromSequence(seq);
+}
+
+/*----------------------------------------------------
+    ǩ
+    ÿְ˳Ѷǩĳھıǩ
+    ȻͬУڰ BFS 
+----------------------------------------------------*/
+inline VertexOrder communityOrder(const CSRGraph& g, int rounds = 5, unsigned seed = 2025) {
+    int V = g.V;
+    std::vector<int> label(V), visit(V);
+    for (int v = 0; v < V; ++v) label[v] = visit[v] = v;
+    std::mt19937 rng(seed);
+    std::vector<int> cnt(V, 0), seen;
+    for (int r = 0; r < rounds; ++r) {
+        std::shuffle(visit.begin(), visit.end(), rng);
+        size_t changed = 0;
+        for (int i = 0; i < V; ++i) {
+            int u = visit[i];
+            int best = label[u], bestCnt = 0;
+            seen.clear();
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int l = label[g.adj[k]];
+                if (cnt[l]++ == 0) seen.push_back(l);
+                if (cnt[l] > bestCnt || (cnt[l] == bestCnt && l < best)) {
+                    best = l;
+                    bestCnt = cnt[l];
+                }
+            }
+            for (size_t j = 0; j < seen.size(); ++j) cnt[seen[j]] = 0;
+            if (best != label[u]) {
+                label[u] = best;
+                changed++;
+            }
+        }
+        if (changed * 1000 < (size_t)V) break;   // ȶ
+    }
+
+    // ǩͬһ㰤һ
+    std::vector<int> start(V + 1, 0), byLabel(V);
+    for (int v = 0; v < V; ++v) start[label[v] + 1]++;
+    for (int l = 0; l < V; ++l) start[l + 1] += start[l];
+    for (int v = 0; v < V; ++v) byLabel[start[label[v]]++] = v;
+
+    //  BFSֻͬǩı
+    std::vector<int> seq;
+    seq.reserve(V);
+    std::vector<char> placed(V, 0);
+    for (int i = 0; i < V; ++i) {
+        int s = byLabel[i];
+        if (placed[s]) continue;
+        size_t head = seq.size();
+        seq.push_back(s);
+        placed[s] = 1;
+        for (; head < seq.size(); ++head) {
+            int u = seq[head];
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                if (!placed[v] && label[v] == label[s]) {
+                    placed[v] = 1;
+                    seq.push_back(v);
+                }
+            }
+        }
+    }
+    return VertexOrder::fromSequence(seq);
+}
+
+#endif
@@ -0,0 +1,205 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include "reorder.h"
+#include "shortest_path.h"
+
+using namespace std;
+
+/*====================================================
+    رŶԱӰ
+      ͼ 11000 x 1000 񣨽·
+      ͼ 2RMAT scale 20ƽ 16
+    ÿֱŲ BFSCSRGraph::BFS SSSPShortestPath Ĳѣʱ
+    ԭźұϵĽ˶
+    ȱʧģ 2MB 16 · LRU ͳƣ
+    BFS а visited / 飨ÿ 8 ֽڣȱʧ
+    룺g++ -O2 -pthread reorder_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+//  LRU ģ⣬ֻ
+class CacheSim {
+public:
+    CacheSim(size_t bytes, int ways) : ways(ways), sets(bytes / 64 / ways), tag(sets * ways, ~0ULL),
+                                       stamp(sets * ways, 0), clock(0), hits(0), misses(0) {}
+
+    void access(uint64_t addr) {
+        uint64_t line = addr >> 6;
+        size_t base = (size_t)(line % sets) * ways;
+        ++clock;
+        size_t victim = base;
+        for (size_t i = base; i < base + ways; ++i) {
+            if (tag[i] == line) {
+                stamp[i] = clock;
+                hits++;
+                return;
+            }
+            if (stamp[i] < stamp[victim]) victim = i;
+        }
+        tag[victim] = line;
+        stamp[victim] = clock;
+        misses++;
+    }
+
+    double missRate() const {
+        return hits + misses ? (double)misses / (hits + misses) : 0.0;
+    }
+
+private:
+    int ways;
+    size_t sets;
+    vector<uint64_t> tag, stamp;
+    uint64_t clock, hits, misses;
+};
+
+static double bfsMissRate(const CSRGraph& g, int s) {
+    CacheSim cache(2 << 20, 16);
+    vector<char> seen(g.V, 0);
+    vector<int> q(1, s);
+    seen[s] = 1;
+    for (size_t h = 0; h < q.size(); ++h) {
+        int u = q[h];
+        for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+            int v = g.adj[k];
+            cache.access((uint64_t)v * 8);
+            if (!seen[v]) {
+                seen[v] = 1;
+                q.push_back(v);
+            }
+        }
+    }
+    return cache.missRate();
+}
+
+// ƽ |u - v|žֲԵĴָ
+static double avgGap(const CSRGraph& g) {
+    double sum = 0;
+    for (int u = 0; u < g.V; ++u)
+        for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) sum += abs(g.adj[k] - u);
+    return g.arcCount() ? sum / g.arcCount() : 0.0;
+}
+
+static vector<GraphEdge> gridGraph(int side, unsigned seed) {
+    mt19937_64 rng(seed);
+    vector<GraphEdge> edges;
+    for (int r = 0; r < side; ++r)
+        for (int c = 0; c < side; ++c) {
+            int v = r * side + c;
+            if (c + 1 < side) edges.push_back(GraphEdge{v, v + 1, (int)(rng() % 100) + 1});
+            if (r + 1 < side) edges.push_back(GraphEdge{v, v + side, (int)(rng() % 100) + 1});
+        }
+    return edges;
+}
+
+static vector<GraphEdge> rmat(int scale, size_t m, unsigned seed) {
+    mt19937_64 rng(seed);
+    uniform_real_distribution<double> uni(0.0, 1.0);
+    vector<GraphEdge> edges(m);
+    for (size_t i = 0; i < m; ++i) {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; ++bit) {
+            double r = uni(rng);
+            if (r < 0.57) continue;
+            if (r < 0.76) v |= 1 << bit;
+            else if (r < 0.95) u |= 1 << bit;
+            else { u |= 1 << bit; v |= 1 << bit; }
+        }
+        edges[i] = GraphEdge{u, v, (int)(rng() % 100) + 1};
+    }
+    return edges;
+}
+
+// ұţģ"˳"
+static void shuffleIds(int V, vector<GraphEdge>& edges, unsigned seed) {
+    vector<int> p(V);
+    for (int v = 0; v < V; ++v) p[v] = v;
+    shuffle(p.begin(), p.end(), mt19937(seed));
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i].u = p[edges[i].u];
+        edges[i].v = p[edges[i].v];
+    }
+}
+
+static bool runCase(const char* name, int V, vector<GraphEdge> edges, MySTL::ThreadPool& pool) {
+    shuffleIds(V, edges, 11);
+    CSRGraph g(V, edges, true, &pool);
+    vector<GraphEdge>().swap(edges);
+
+    // ԴȡĶ㣬֤ڴ
+    int src = 0;
+    for (int v = 1; v < V; ++v)
+        if (g.degree(v) > g.degree(src)) src = v;
+
+    ShortestPath base(g);
+    base.run(src);
+    vector<long long> refDist = base.distances();
+    vector<int> refBfs = g.BFS(src);
+    sort(refBfs.begin(), refBfs.end());
+
+    printf("\n%s  V = %d   %zu\n", name, V, (size_t)g.arcCount());
+    printf("%-8s %10s %10s %10s %10s %10s %8s\n", "", " ms", "ؽ ms", "BFS ms", "SSSP ms",
+           "ƽ", "ȱʧ");
+    const char* names[] = {"", "", "RCM", ""};
+    bool ok = true;
+    double baseBfs = 0, baseSp = 0;
+    for (int m = 0; m < 4; ++m) {
+        VertexOrder ord;
+        double to = timeMs([&] {
+            if (m == 0) {
+                vector<int> id(V);
+                for (int v = 0; v < V; ++v) id[v] = v;
+                ord = VertexOrder(id);
+            } else if (m == 1) {
+                ord = degreeOrder(g);
+            } else if (m == 2) {
+                ord = rcmOrder(g);
+            } else {
+                ord = communityOrder(g);
+            }
+        });
+        CSRGraph h;
+        double tp = timeMs([&] { h = ord.apply(g, &pool); });
+        int s = ord.toNew(src);
+
+        vector<int> order;
+        double tb = 1e30;
+        for (int r = 0; r < 3; ++r) tb = min(tb, timeMs([&] { order = h.BFS(s); }));
+        ShortestPath sp(h);
+        double ts = 1e30;
+        for (int r = 0; r < 3; ++r) ts = min(ts, timeMs([&] { sp.run(s); }));
+        if (m == 0) {
+            baseBfs = tb;
+            baseSp = ts;
+        }
+
+        // ԭź˶
+        vector<int> visited = ord.mapBackList(order);
+        sort(visited.begin(), visited.end());
+        bool same = visited == refBfs && ord.mapBack(sp.distances()) == refDist;
+        ok = ok && same;
+        printf("%-8s %10.1f %10.1f %7.1f x%.2f %7.1f x%.2f %10.0f %7.1f%% %s\n", names[m], to, tp,
+               tb, baseBfs / tb, ts, baseSp / ts, avgGap(h), 100.0 * bfsMissRate(h, s), same ? "OK" : "һ");
+    }
+    return ok;
+}
+
+int main() {
+    MySTL::ThreadPool pool;
+    bool ok = true;
+    ok = runCase(" 1000 x 1000", 1000000, gridGraph(1000, 1), pool) && ok;
+    ok = runCase("RMAT scale 20", 1 << 20, rmat(20, (size_t)16 << 20, 2), pool) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+#ifndef SHORTEST_PATH_H
+#define SHORTEST_PATH_H
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "csr_graph.h"
+#include "../../MySTL/bitmap.h"
+
+/*====================================================
+    λ D ѣ֧ decrease-key
+    pos[v] ¼ v ڶе±꣬ڶΪ -1
+    ʱ˳ָλԶβѯ֮䲻
+====================================================*/
+template<int D>
+class IndexedHeap {
+private:
+    std::vector<std::pair<long long, int> > heap;   // (, )
+    std::vector<int> pos;
+
+    void place(size_t i, const std::pair<long long, int>& e) {
+        heap[i] = e;
+        pos[e.second] = (int)i;
+    }
+
+    void siftUp(size_t i) {
+        std::pair<long long, int> e = heap[i];
+        while (i > 0) {
+            size_t p = (i - 1) / D;
+            if (heap[p].first <= e.first) break;
+            place(i, heap[p]);
+            i = p;
+        }
+        place(i, e);
+    }
+
+    void siftDown(size_t i) {
+        std::pair<long long, int> e = heap[i];
+        size_t n = heap.size();
+        for (;;) {
+            size_t c = i * D + 1;
+            if (c >= n) break;
+            size_t best = c;
+            size_t last = std::min(c + D, n);
+            for (size_t j = c + 1; j < last; ++j)
+                if (heap[j].first < heap[best].first) best = j;
+            if (heap[best].first >= e.first) break;
+            place(i, heap[best]);
+            i = best;
+        }
+        place(i, e);
+    }
+
+public:
+    explicit IndexedHeap(int n = 0) : pos(n, -1) {}
+
+    void resize(int n) {
+        pos.assign(n, -1);
+        heap.clear();
+    }
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    long long topKey() const {
+        return heap[0].first;
+    }
+
+    // ڶ룬ڼСʱϸ
+    void push(int v, long long k) {
+        if (pos[v] < 0) {
+            heap.push_back(std::make_pair(k, v));
+            siftUp(heap.size() - 1);
+        } else if (k < heap[pos[v]].first) {
+            heap[pos[v]].first = k;
+            siftUp(pos[v]);
+        }
+    }
+
+    std::pair<long long, int> pop() {
+        std::pair<long long, int> top = heap[0];
+        pos[top.second] = -1;
+        std::pair<long long, int> last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return top;
+    }
+
+    // ǰʱֻλڶĶ
+    void clear() {
+        for (size_t i = 0; i < heap.size(); ++i) pos[heap[i].second] = -1;
+        heap.clear();
+    }
+};
+
+/*====================================================
+    ѣȶУ
+    ϴγѼ last ߲ͬλͰ
+    ʱֻط͵ķǿͰDijkstra ĳѼ
+    ʺСȨû decrease-keyѺɵ÷
+====================================================*/
+class RadixHeap {
+private:
+    std::vector<std::pair<long long, int> > buckets[65];
+    uint64_t last;
+    size_t count;
+
+    static int bucketOf(uint64_t k, uint64_t last) {
+        return k == last ? 0 : 64 - MySTL::clz64(k ^ last);
+    }
+
+public:
+    RadixHeap() : last(0), count(0) {}
+
+    void resize(int) {
+        clear();
+    }
+
+    bool empty() const {
+        return count == 0;
+    }
+
+    void push(int v, long long k) {
+        buckets[bucketOf((uint64_t)k, last)].push_back(std::make_pair(k, v));
+        count++;
+    }
+
+    std::pair<long long, int> pop() {
+        if (buckets[0].empty()) {
+            int i = 1;
+            while (buckets[i].empty()) i++;
+            std::vector<std::pair<long long, int> >& b = buckets[i];
+            uint64_t mn = (uint64_t)b[0].first;
+            for (size_t j = 1; j < b.size(); ++j) mn = std::min(mn, (uint64_t)b[j].first);
+            last = mn;
+            for (size_t j = 0; j < b.size(); ++j) buckets[bucketOf((uint64_t)b[j].first, last)].push_back(b[j]);
+            b.clear();
+        }
+        std::pair<long long, int> top = buckets[0].back();
+        buckets[0].pop_back();
+        count--;
+        return top;
+    }
+
+    // Ͱ´βѯٷ
+    void clear() {
+        for (int i = 0; i < 65; ++i) buckets[i].clear();
+        last = 0;
+        count = 0;
+    }
+};
+
+/*====================================================
+    Դ / Դ·ҪȨǸ
+    distpredѣڶڸã
+    ÿβѯֻλϴĶ㣬·
+====================================================*/
+class ShortestPath {
+public:
+    enum HeapKind { BINARY_HEAP, QUAD_HEAP, RADIX_HEAP };
+
+    explicit ShortestPath(const CSRGraph& graph) : g(graph) {
+        for (size_t k = 0; k < g.weight.size(); ++k)
+            if (g.weight[k] < 0) throw std::invalid_argument("ShortestPath: negative edge weight");
+        dist.assign(g.V, CSR_INF);
+        pred.assign(g.V, -1);
+        done.assign(g.V, 0);
+        heap2.resize(g.V);
+        heap4.resize(g.V);
+    }
+
+    /*------------------------------------------------
+         sources жͬʱtarget >= 0 ʱ
+        target ѼֹͣʱֻѳѶľֵ
+    ------------------------------------------------*/
+    void run(const std::vector<int>& sources, int target = -1, HeapKind kind = QUAD_HEAP) {
+        reset();
+        for (size_t i = 0; i < sources.size(); ++i) {
+            int s = sources[i];
+            if ((unsigned)s >= (unsigned)g.V) throw std::invalid_argument("ShortestPath: source out of range");
+            if (dist[s] == 0) continue;
+            dist[s] = 0;
+            touched.push_back(s);
+        }
+        switch (kind) {
+        case BINARY_HEAP: search(heap2, target); break;
+        case QUAD_HEAP: search(heap4, target); break;
+        default: search(radix, target); break;
+        }
+    }
+
+    void run(int source, int target = -1, HeapKind kind = QUAD_HEAP) {
+        std::vector<int> s(1, source);
+        run(s, target, kind);
+    }
+
+    long long distance(int v) const {
+        return dist[v];
+    }
+
+    // ·ϵǰԴͲɴΪ -1
+    int predecessor(int v) const {
+        return pred[v];
+    }
+
+    bool settled(int v) const {
+        return done[v] != 0;
+    }
+
+    const std::vector<long long>& distances() const {
+        return dist;
+    }
+
+    const std::vector<int>& predecessors() const {
+        return pred;
+    }
+
+    // ǰݳ t ·Դ㣩ɴﷵؿ
+    std::vector<int> path(int t) const {
+        std::vector<int> p;
+        if (dist[t] == CSR_INF) return p;
+        for (int v = t; v != -1; v = pred[v]) p.push_back(v);
+        std::reverse(p.begin(), p.end());
+        return p;
+    }
+
+    // βѯĶ
+    size_t touchedCount() const {
+        return touched.size();
+    }
+
+private:
+    const CSRGraph& g;
+    std::vector<long long> dist;
+    std::vector<int> pred;
+    std::vector<char> done;
+    std::vector<int> touched;      // dist дĶ
+    IndexedHeap<2> heap2;
+    IndexedHeap<4> heap4;
+    RadixHeap radix;
+
+    void reset() {
+        for (size_t i = 0; i < touched.size(); ++i) {
+            int v = touched[i];
+            dist[v] = CSR_INF;
+            pred[v] = -1;
+            done[v] = 0;
+        }
+        touched.clear();
+    }
+
+    template<typename Heap>
+    void search(Heap& heap, int target) {
+        for (size_t i = 0; i < touched.size(); ++i) heap.push(touched[i], 0);
+        while (!heap.empty()) {
+            std::pair<long long, int> top = heap.pop();
+            int u = top.second;
+            if (done[u] || top.first != dist[u]) continue;   // ѵĹ
+            done[u] = 1;
+            if (u == target) break;
+            long long du = top.first;
+            for (uint64_t k = g.offsets[u]; k < g.offsets[u + 1]; ++k) {
+                int v = g.adj[k];
+                long long nd = du + g.weight[k];
+                if (nd < dist[v]) {
+                    if (dist[v] == CSR_INF) touched.push_back(v);
+                    dist[v] = nd;
+                    pred[v] = u;
+                    heap.push(v, nd);
+                }
+            }
+        }
+        heap.clear();
+    }
+};
+
+#endif
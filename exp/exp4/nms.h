@@ -0,0 +1,380 @@
+#ifndef NMS_H
+#define NMS_H
+
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <algorithm>
+
+using namespace std;
+
+
+struct Box {
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    double score;
+};
+
+
+inline double IoU(const Box &a, const Box &b) {
+    double xx1 = max(a.x1, b.x1);
+    double yy1 = max(a.y1, b.y1);
+    double xx2 = min(a.x2, b.x2);
+    double yy2 = min(a.y2, b.y2);
+
+    double w = max(0.0, xx2 - xx1);
+    double h = max(0.0, yy2 - yy1);
+    double inter = w * h;
+
+    if (inter <= 0.0) return 0.0;
+
+    double areaA = (a.x2 - a.x1) * (a.y2 - a.y1);
+    double areaB = (b.x2 - b.x1) * (b.y2 - b.y1);
+    double uni = areaA + areaB - inter;
+    if (uni <= 0.0) return 0.0;
+
+    return inter / uni;
+}
+
+
+inline void quickSortIndices(vector<int> &idx, int left, int right, const vector<Box> &boxes) {
+    if (left >= right) return;
+    int i = left, j = right;
+    double pivot = boxes[idx[(left + right) / 2]].score;
+
+    while (i <= j) {
+        while (boxes[idx[i]].score > pivot) i++;   
+        while (boxes[idx[j]].score < pivot) j--;  
+        if (i <= j) {
+            int tmp = idx[i];
+            idx[i] = idx[j];
+            idx[j] = tmp;
+            i++;
+            j--;
+        }
+    }
+    if (left < j) quickSortIndices(idx, left, j, boxes);
+    if (i < right) quickSortIndices(idx, i, right, boxes);
+}
+
+inline vector<int> quick_sort_indices(const vector<Box> &boxes) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    for (int i = 0; i < n; ++i) idx[i] = i;
+    if (n > 0)
+        quickSortIndices(idx, 0, n - 1, boxes);
+    return idx;
+}
+
+
+inline void mergeIndices(vector<int> &idx, int l, int m, int r, const vector<Box> &boxes) {
+    int n1 = m - l + 1;
+    int n2 = r - m;
+    vector<int> L(n1), R(n2);
+    for (int i = 0; i < n1; ++i) L[i] = idx[l + i];
+    for (int j = 0; j < n2; ++j) R[j] = idx[m + 1 + j];
+
+    int i = 0, j = 0, k = l;
+    while (i < n1 && j < n2) {
+        if (boxes[L[i]].score >= boxes[R[j]].score) {
+            idx[k++] = L[i++];
+        } else {
+            idx[k++] = R[j++];
+        }
+    }
+    while (i < n1) idx[k++] = L[i++];
+    while (j < n2) idx[k++] = R[j++];
+}
+
+inline void mergeSortIndices(vector<int> &idx, int l, int r, const vector<Box> &boxes) {
+    if (l >= r) return;
+    int m = (l + r) / 2;
+    mergeSortIndices(idx, l, m, boxes);
+    mergeSortIndices(idx, m + 1, r, boxes);
+    mergeIndices(idx, l, m, r, boxes);
+}
+
+inline vector<int> merge_sort_indices(const vector<Box> &boxes) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    for (int i = 0; i < n; ++i) idx[i] = i;
+    if (n > 0)
+        mergeSortIndices(idx, 0, n - 1, boxes);
+    return idx;
+}
+
+
+inline void heapify(vector<int> &idx, int n, int i, const vector<Box> &boxes) {
+    int largest = i;
+    int l = 2 * i + 1;
+    int r = 2 * i + 2;
+
+    if (l < n && boxes[idx[l]].score > boxes[idx[largest]].score)
+        largest = l;
+    if (r < n && boxes[idx[r]].score > boxes[idx[largest]].score)
+        largest = r;
+
+    if (largest != i) {
+        int tmp = idx[i];
+        idx[i] = idx[largest];
+        idx[largest] = tmp;
+        heapify(idx, n, largest, boxes);
+    }
+}
+
+inline vector<int> heap_sort_indices(const vector<Box> &boxes) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    for (int i = 0; i < n; ++i) idx[i] = i;
+
+
+    for (int i = n / 2 - 1; i >= 0; --i)
+        heapify(idx, n, i, boxes);
+
+ 
+    for (int i = n - 1; i >= 0; --i) {
+        int tmp = idx[0];
+        idx[0] = idx[i];
+        idx[i] = tmp;
+        heapify(idx, i, 0, boxes);
+    }
+
+   
+    for (int i = 0; i < n / 2; ++i) {
+        int tmp = idx[i];
+        idx[i] = idx[n - 1 - i];
+        idx[n - 1 - i] = tmp;
+    }
+    return idx;
+}  
+
+
+inline vector<int> insertion_sort_indices(const vector<Box> &boxes) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    for (int i = 0; i < n; ++i) idx[i] = i;
+
+    for (int i = 1; i < n; ++i) {
+        int key = idx[i];
+        double keyScore = boxes[key].score;
+        int j = i - 1;
+        while (j >= 0 && boxes[idx[j]].score < keyScore) {
+            idx[j + 1] = idx[j];
+            --j;
+        }
+        idx[j + 1] = key;
+    }
+    return idx;
+}
+
+
+/*----------------------------------------------------
+    򣺰 (, ±) ѹһ 64 λֻż׷
+    boxes[idx].score Ƚ
+      λıλȡļСص idxBits λ
+      λ±꣬ضϺͬʱ±Сǰ
+    LSDÿ 11 λһ˵ֱͼ
+    ͬһͰ
+    صĵλֻڷǰ׺ͬһСӰ죬ɨһ飬
+    ЩΰһΣһ
+----------------------------------------------------*/
+static const int RADIX_BITS = 11;
+static const int RADIX_PASSES = (64 + RADIX_BITS - 1) / RADIX_BITS;
+
+// double λӳ޷ִС˳
+inline uint64_t score_order_bits(double s) {
+    uint64_t u;
+    memcpy(&u, &s, sizeof(u));
+    return (u >> 63) ? ~u : (u | 0x8000000000000000ULL);
+}
+
+//  n ±Ҫλ
+inline int radix_index_bits(int n) {
+    int bits = 1;
+    while (bits < 31 && (1 << bits) < n) ++bits;
+    return bits;
+}
+
+inline uint64_t radix_key(const vector<Box> &boxes, int i, int idxBits) {
+    uint64_t hi = ~score_order_bits(boxes[i].score);
+    return (hi >> idxBits << idxBits) | (uint64_t)i;
+}
+
+//  keys  LSD tmphist Ϊɿø
+inline void radix_sort_keys(vector<uint64_t> &keys, vector<uint64_t> &tmp, vector<size_t> &hist) {
+    size_t n = keys.size();
+    if (n == 0) return;
+    const size_t buckets = (size_t)1 << RADIX_BITS;
+    hist.assign(buckets * RADIX_PASSES, 0);
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t k = keys[i];
+        for (int p = 0; p < RADIX_PASSES; ++p) hist[p * buckets + ((k >> (p * RADIX_BITS)) & (buckets - 1))]++;
+    }
+    tmp.resize(n);
+    for (int p = 0; p < RADIX_PASSES; ++p) {
+        size_t *h = &hist[p * buckets];
+        int shift = p * RADIX_BITS;
+        if (h[(keys[0] >> shift) & (buckets - 1)] == n) continue;   // һмͬͰ
+        size_t sum = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            size_t c = h[b];
+            h[b] = sum;
+            sum += c;
+        }
+        for (size_t i = 0; i < n; ++i) tmp[h[(keys[i] >> shift) & (buckets - 1)]++] = keys[i];
+        keys.swap(tmp);
+    }
+}
+
+// ضǰ׺ͬĶΰidx Ѱź
+inline void radix_fix_ties(vector<int> &idx, const vector<uint64_t> &keys, int idxBits, const vector<Box> &boxes) {
+    size_t n = keys.size();
+    for (size_t a = 0; a < n;) {
+        size_t b = a + 1;
+        while (b < n && (keys[b] >> idxBits) == (keys[a] >> idxBits)) ++b;
+        if (b - a > 1) {
+            std::sort(idx.begin() + a, idx.begin() + b, [&](int x, int y) {
+                double sx = boxes[x].score, sy = boxes[y].score;
+                return sx != sy ? sx > sy : x < y;
+            });
+        }
+        a = b;
+    }
+}
+
+inline vector<int> radix_sort_indices(const vector<Box> &boxes) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    if (n == 0) return idx;
+    int idxBits = radix_index_bits(n);
+    vector<uint64_t> keys(n), tmp;
+    vector<size_t> hist;
+    for (int i = 0; i < n; ++i) keys[i] = radix_key(boxes, i, idxBits);
+    radix_sort_keys(keys, tmp, hist);
+    uint64_t mask = ((uint64_t)1 << idxBits) - 1;
+    for (int i = 0; i < n; ++i) idx[i] = (int)(keys[i] & mask);
+    radix_fix_ties(idx, keys, idxBits, boxes);
+    return idx;
+}
+
+
+//  algo_name ѡ㷨õ±ꣻδ֪ÿ
+inline vector<int> sort_indices(const vector<Box> &boxes, const string &algo_name) {
+    if (algo_name == "merge") return merge_sort_indices(boxes);
+    if (algo_name == "heap") return heap_sort_indices(boxes);
+    if (algo_name == "insertion") return insertion_sort_indices(boxes);
+    if (algo_name == "radix") return radix_sort_indices(boxes);
+    return quick_sort_indices(boxes);
+}
+
+
+inline vector<Box> nms(const vector<Box> &boxes,
+                double iou_threshold,
+                const string &algo_name) {
+    int n = (int)boxes.size();
+    if (n == 0) return vector<Box>();
+
+    vector<int> sorted_idx = sort_indices(boxes, algo_name);
+
+    vector<bool> suppressed(n, false);
+    vector<int> picked;
+
+    for (int i = 0; i < n; ++i) {
+        if (suppressed[i]) continue;
+        int idx_i = sorted_idx[i];
+        picked.push_back(idx_i);
+
+        for (int j = i + 1; j < n; ++j) {
+            if (suppressed[j]) continue;
+            int idx_j = sorted_idx[j];
+            double iou = IoU(boxes[idx_i], boxes[idx_j]);
+            if (iou > iou_threshold) {
+                suppressed[j] = true;
+            }
+        }
+    }
+
+    vector<Box> result;
+    result.reserve(picked.size());
+    for (size_t k = 0; k < picked.size(); ++k) {
+        result.push_back(boxes[picked[k]]);
+    }
+    return result;
+}
+
+
+inline Box make_random_box(int img_w, int img_h) {
+    int w = rand() % 181 + 20; // 20~200
+    int h = rand() % 181 + 20;
+    int x1 = rand() % (img_w - w + 1);
+    int y1 = rand() % (img_h - h + 1);
+    int x2 = x1 + w;
+    int y2 = y1 + h;
+    double score = (double)rand() / RAND_MAX;
+    Box b;
+    b.x1 = x1; b.y1 = y1; b.x2 = x2; b.y2 = y2; b.score = score;
+    return b;
+}
+
+
+inline vector<Box> generate_random_boxes(int n, int img_w = 1000, int img_h = 1000) {
+    vector<Box> boxes;
+    boxes.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        boxes.push_back(make_random_box(img_w, img_h));
+    }
+    return boxes;
+}
+
+
+inline vector<Box> generate_clustered_boxes(int n,
+                                     int img_w = 1000,
+                                     int img_h = 1000,
+                                     int num_clusters = 5) {
+    vector<Box> boxes;
+    boxes.reserve(n);
+
+
+    vector<pair<int,int> > centers;
+    for (int i = 0; i < num_clusters; ++i) {
+        int cx = rand() % (img_w - 200) + 100;
+        int cy = rand() % (img_h - 200) + 100;
+        centers.push_back(make_pair(cx, cy));
+    }
+
+    for (int i = 0; i < n; ++i) {
+        int c = rand() % num_clusters;
+        int cx = centers[c].first;
+        int cy = centers[c].second;
+
+        int dx = rand() % 101 - 50;
+        int dy = rand() % 101 - 50;
+
+        int w = rand() % 181 + 20;
+        int h = rand() % 181 + 20;
+
+        int x1 = cx + dx - w / 2;
+        int y1 = cy + dy - h / 2;
+
+        if (x1 < 0) x1 = 0;
+        if (y1 < 0) y1 = 0;
+        if (x1 + w > img_w) x1 = img_w - w;
+        if (y1 + h > img_h) y1 = img_h - h;
+
+        int x2 = x1 + w;
+        int y2 = y1 + h;
+        double score = (double)rand() / RAND_MAX;
+
+        Box b;
+        b.x1 = x1; b.y1 = y1; b.x2 = x2; b.y2 = y2; b.score = score;
+        boxes.push_back(b);
+    }
+    return boxes;
+}
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef NMS_BATCHED_H
+#define NMS_BATCHED_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+#include "nms.h"
+#include "nms_simd.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+     NMSһεôһͼļ
+      ÿ (image_id, class_id)ͬͼ֮ͬŻ
+    1. ͼ飬ͼ֮䲢
+    2. ÿͼֵ ->  -> ÿ top-k Ԥɸ
+       nth_element ѡ񣬲ȫ-> ÿ SIMD NMS
+    3. ౣϲȡǰ max_per_image 
+    offset_trick Ϊʱ𣬶ǰѵ c ƽ c * ȣ
+    ͬĿ򲻿ཻͼֻһ NMS
+====================================================*/
+
+struct Detection {
+    Box box;
+    int image_id;
+    int class_id;
+};
+
+struct BatchedNMSOptions {
+    double iou_threshold;
+    double score_threshold;    // ĿֱӶ
+    int pre_topk;              // ÿ (ͼ, ) NMS ǰౣĿ0 
+    int max_per_image;         // ÿͼĿ0 
+    bool offset_trick;
+
+    BatchedNMSOptions()
+        : iou_threshold(0.5), score_threshold(0.0), pre_topk(0), max_per_image(0), offset_trick(false) {}
+};
+
+/*----------------------------------------------------
+    ̵߳Ĺͼãⷴ
+----------------------------------------------------*/
+struct BatchedNMSWorkspace {
+    vector<int> cand, part, order, classStart, kept, picked;
+    vector<Box> boxes;
+    vector<uint64_t> removed;
+    BoxBatch batch;
+};
+
+namespace batched_nms_detail {
+
+// ±򣺽˳޹
+struct ScoreGreater {
+    const vector<Detection> *dets;
+    bool operator()(int a, int b) const {
+        double sa = (*dets)[a].box.score, sb = (*dets)[b].box.score;
+        return sa != sb ? sa > sb : a < b;
+    }
+};
+
+//  ids źһ NMSļ±׷ӵ out
+inline void run_nms(const vector<Detection> &dets, vector<int> &ids, double thr, double offsetUnit,
+                    BatchedNMSWorkspace &ws, vector<int> &out) {
+    ScoreGreater cmp = {&dets};
+    std::sort(ids.begin(), ids.end(), cmp);
+    ws.boxes.resize(ids.size());
+    ws.order.resize(ids.size());
+    for (size_t k = 0; k < ids.size(); ++k) {
+        Box b = dets[ids[k]].box;
+        if (offsetUnit > 0) {
+            double off = dets[ids[k]].class_id * offsetUnit;
+            b.x1 += off;
+            b.y1 += off;
+            b.x2 += off;
+            b.y2 += off;
+        }
+        ws.boxes[k] = b;
+        ws.order[k] = (int)k;
+    }
+    ws.batch.load(ws.boxes, ws.order);
+    ws.kept.clear();
+    nms_simd_ranks(ws.batch, thr, ws.removed, ws.kept);
+    for (size_t k = 0; k < ws.kept.size(); ++k) out.push_back(ids[ws.kept[k]]);
+}
+
+// top-k Ԥɸֻǰ k Ųǰ棬
+inline void keep_topk(const vector<Detection> &dets, vector<int> &ids, int k) {
+    if (k <= 0 || (int)ids.size() <= k) return;
+    ScoreGreater cmp = {&dets};
+    std::nth_element(ids.begin(), ids.begin() + (k - 1), ids.end(), cmp);
+    ids.resize(k);
+}
+
+} // namespace batched_nms_detail
+
+/*----------------------------------------------------
+    dets  image_id  [0, num_images)class_id Ǹ
+    ÿͼı±ָ dets
+    pool Ϊʱ߳
+----------------------------------------------------*/
+inline vector<vector<int> > batched_nms_indices(const vector<Detection> &dets, int num_images,
+                                                const BatchedNMSOptions &opt,
+                                                MySTL::ThreadPool *pool = NULL) {
+    using namespace batched_nms_detail;
+    if (num_images < 0) throw std::invalid_argument("batched_nms: negative image count");
+    int numClasses = 0;
+    double maxCoord = 0;
+    vector<int> imgStart(num_images + 1, 0);
+    for (size_t i = 0; i < dets.size(); ++i) {
+        const Detection &d = dets[i];
+        if (d.image_id < 0 || d.image_id >= num_images || d.class_id < 0)
+            throw std::invalid_argument("batched_nms: bad image or class id");
+        imgStart[d.image_id + 1]++;
+        numClasses = max(numClasses, d.class_id + 1);
+        maxCoord = max(maxCoord, max(std::fabs(d.box.x2), std::fabs(d.box.y2)));
+        maxCoord = max(maxCoord, max(std::fabs(d.box.x1), std::fabs(d.box.y1)));
+    }
+    for (int g = 0; g < num_images; ++g) imgStart[g + 1] += imgStart[g];
+    vector<int> byImage(dets.size());
+    {
+        vector<int> at(imgStart.begin(), imgStart.end() - 1);
+        for (size_t i = 0; i < dets.size(); ++i) byImage[at[dets[i].image_id]++] = (int)i;
+    }
+    // ƽƿȣһ֤ͬĿཻ
+    double offsetUnit = opt.offset_trick ? 2 * maxCoord + 1 : 0.0;
+
+    vector<vector<int> > result(num_images);
+    int threads = pool ? pool->size() : 1;
+    vector<BatchedNMSWorkspace> spaces(threads);
+
+    auto work = [&](size_t g0, size_t g1, int tid) {
+        BatchedNMSWorkspace &ws = spaces[tid];
+        for (size_t g = g0; g < g1; ++g) {
+            vector<int> &out = result[g];
+            out.clear();
+            // 
+            ws.cand.clear();
+            for (int k = imgStart[g]; k < imgStart[g + 1]; ++k)
+                if (dets[byImage[k]].box.score > opt.score_threshold) ws.cand.push_back(byImage[k]);
+            if (ws.cand.empty()) continue;
+
+            //  ws.picked
+            ws.classStart.assign(numClasses + 1, 0);
+            for (size_t k = 0; k < ws.cand.size(); ++k) ws.classStart[dets[ws.cand[k]].class_id + 1]++;
+            for (int c = 0; c < numClasses; ++c) ws.classStart[c + 1] += ws.classStart[c];
+            ws.order.assign(ws.classStart.begin(), ws.classStart.end() - 1);
+            ws.picked.resize(ws.cand.size());
+            for (size_t k = 0; k < ws.cand.size(); ++k)
+                ws.picked[ws.order[dets[ws.cand[k]].class_id]++] = ws.cand[k];
+
+            // ÿ top-k Ԥɸƽģʽ NMSƽģʽռͼһ NMS
+            ws.cand.clear();
+            for (int c = 0; c < numClasses; ++c) {
+                if (ws.classStart[c] == ws.classStart[c + 1]) continue;
+                ws.part.assign(ws.picked.begin() + ws.classStart[c], ws.picked.begin() + ws.classStart[c + 1]);
+                keep_topk(dets, ws.part, opt.pre_topk);
+                if (opt.offset_trick)
+                    ws.cand.insert(ws.cand.end(), ws.part.begin(), ws.part.end());
+                else
+                    run_nms(dets, ws.part, opt.iou_threshold, 0.0, ws, out);
+            }
+            if (opt.offset_trick) run_nms(dets, ws.cand, opt.iou_threshold, offsetUnit, ws, out);
+
+            // ϲ󰴷ȡǰ max_per_image 
+            ScoreGreater cmp = {&dets};
+            if (opt.max_per_image > 0 && (int)out.size() > opt.max_per_image) {
+                std::partial_sort(out.begin(), out.begin() + opt.max_per_image, out.end(), cmp);
+                out.resize(opt.max_per_image);
+            } else {
+                std::sort(out.begin(), out.end(), cmp);
+            }
+        }
+    };
+    if (pool)
+        pool->parallelFor((size_t)num_images, 1, work);
+    else
+        work(0, (size_t)num_images, 0);
+    return result;
+}
+
+// ͬϣֱӷؼ
+inline vector<vector<Detection> > batched_nms(const vector<Detection> &dets, int num_images,
+                                              const BatchedNMSOptions &opt,
+                                              MySTL::ThreadPool *pool = NULL) {
+    vector<vector<int> > idx = batched_nms_indices(dets, num_images, opt, pool);
+    vector<vector<Detection> > out(num_images);
+    for (int g = 0; g < num_images; ++g) {
+        out[g].reserve(idx[g].size());
+        for (size_t k = 0; k < idx[g].size(); ++k) out[g].push_back(dets[idx[g][k]]);
+    }
+    return out;
+}
+
+#endif
@@ -0,0 +1,169 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_batched.h"
+
+using namespace std;
+
+/*====================================================
+     NMS64 ͼ x 80 
+      ÿͼ 12 ֣ÿɴضӵͷ
+      naive   :  (ͼ, ) Ͱ nms()
+      batched : batched_nms SIMD NMSѡ߳
+      offset  : batched_nms ƽģʽÿͼһ NMS
+    ޹ʱ batched / offset Ľ naive һ
+    룺g++ -O2 -mavx2 -pthread nms_batched_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static bool detLess(const Detection &a, const Detection &b) {
+    if (a.box.score != b.box.score) return a.box.score > b.box.score;
+    if (a.class_id != b.class_id) return a.class_id < b.class_id;
+    if (a.box.x1 != b.box.x1) return a.box.x1 < b.box.x1;
+    if (a.box.y1 != b.box.y1) return a.box.y1 < b.box.y1;
+    if (a.box.x2 != b.box.x2) return a.box.x2 < b.box.x2;
+    return a.box.y2 < b.box.y2;
+}
+
+// ÿͼͬһȽ
+static bool sameResult(vector<vector<Detection> > a, vector<vector<Detection> > b) {
+    if (a.size() != b.size()) return false;
+    for (size_t g = 0; g < a.size(); ++g) {
+        if (a[g].size() != b[g].size()) return false;
+        sort(a[g].begin(), a[g].end(), detLess);
+        sort(b[g].begin(), b[g].end(), detLess);
+        for (size_t k = 0; k < a[g].size(); ++k)
+            if (detLess(a[g][k], b[g][k]) || detLess(b[g][k], a[g][k])) return false;
+    }
+    return true;
+}
+
+static vector<Detection> makeBatch(int images, int classes) {
+    vector<Detection> dets;
+    for (int g = 0; g < images; ++g) {
+        for (int t = 0; t < 12; ++t) {
+            int c = rand() % classes;
+            vector<Box> boxes = generate_clustered_boxes(rand() % 200 + 50, 1000, 1000, rand() % 4 + 1);
+            for (size_t k = 0; k < boxes.size(); ++k) {
+                Detection d = {boxes[k], g, c};
+                dets.push_back(d);
+            }
+        }
+        // ͷɢ
+        for (int k = 0; k < 800; ++k) {
+            Detection d = {make_random_box(1000, 1000), g, rand() % classes};
+            d.box.score *= 0.05;
+            dets.push_back(d);
+        }
+    }
+    // ңģͷԭʼ˳
+    for (size_t i = dets.size(); i > 1; --i) swap(dets[i - 1], dets[rand() % i]);
+    return dets;
+}
+
+static vector<vector<Detection> > naiveBatched(const vector<Detection> &dets, int images, int classes,
+                                               double thr) {
+    vector<vector<Box> > bucket((size_t)images * classes);
+    for (size_t i = 0; i < dets.size(); ++i)
+        bucket[(size_t)dets[i].image_id * classes + dets[i].class_id].push_back(dets[i].box);
+    vector<vector<Detection> > out(images);
+    for (int g = 0; g < images; ++g)
+        for (int c = 0; c < classes; ++c) {
+            vector<Box> kept = nms(bucket[(size_t)g * classes + c], thr, "quick");
+            for (size_t k = 0; k < kept.size(); ++k) {
+                Detection d = {kept[k], g, c};
+                out[g].push_back(d);
+            }
+        }
+    return out;
+}
+
+static size_t totalKept(const vector<vector<Detection> > &r) {
+    size_t s = 0;
+    for (size_t g = 0; g < r.size(); ++g) s += r[g].size();
+    return s;
+}
+
+int main() {
+    srand(2025);
+    const int images = 64, classes = 80;
+    const double thr = 0.5;
+    vector<Detection> dets = makeBatch(images, classes);
+    bool allOk = true;
+
+    printf("====  NMS%d ͼ x %d ࣬ %zu ں %s====\n", images, classes,
+           dets.size(), nms_simd_kernel_name());
+
+    vector<vector<Detection> > ref;
+    double tn = timeMs([&] { ref = naiveBatched(dets, images, classes, thr); });
+    printf("naive  nms()        %8.1f ms |  %zu\n", tn, totalKept(ref));
+
+    BatchedNMSOptions opt;
+    opt.iou_threshold = thr;
+    opt.score_threshold = -1.0;
+    vector<vector<Detection> > r;
+    double tb = timeMs([&] { r = batched_nms(dets, images, opt); });
+    bool ok = sameResult(ref, r);
+    allOk = allOk && ok;
+    printf("batched ߳          %8.1f ms |  %zu | x%.1f %s\n", tb, totalKept(r), tn / tb,
+           ok ? "OK" : "һ");
+
+    opt.offset_trick = true;
+    double to = timeMs([&] { r = batched_nms(dets, images, opt); });
+    ok = sameResult(ref, r);
+    allOk = allOk && ok;
+    printf("offset ߳           %8.1f ms |  %zu | x%.1f %s\n", to, totalKept(r), tn / to,
+           ok ? "OK" : "һ");
+    opt.offset_trick = false;
+
+    // ˣֵ + ÿ top-k + ÿͼ
+    opt.score_threshold = 0.05;
+    opt.pre_topk = 100;
+    opt.max_per_image = 100;
+    vector<vector<Detection> > f;
+    double tf = timeMs([&] { f = batched_nms(dets, images, opt); });
+    size_t hit = 0, want = 0;
+    for (int g = 0; g < images; ++g) {
+        //  naive зߵ 100 Ƚٻ
+        vector<Detection> top = ref[g];
+        sort(top.begin(), top.end(), detLess);
+        if (top.size() > 100) top.resize(100);
+        want += top.size();
+        for (size_t k = 0; k < top.size(); ++k)
+            for (size_t j = 0; j < f[g].size(); ++j)
+                if (!detLess(top[k], f[g][j]) && !detLess(f[g][j], top[k])) {
+                    hit++;
+                    break;
+                }
+    }
+    printf("batched  (thr 0.05, topk 100, max 100) %8.1f ms |  %zu |  naive ǰ 100 غ %.1f%%\n",
+           tf, totalKept(f), 100.0 * hit / max((size_t)1, want));
+    opt.score_threshold = -1.0;
+    opt.pre_topk = 0;
+    opt.max_per_image = 0;
+
+    printf("\n-- ͼ䲢УӲ߳ %u--\n", thread::hardware_concurrency());
+    double base = 0;
+    for (int t = 1; t <= 8; t *= 2) {
+        MySTL::ThreadPool pool(t);
+        double tp = timeMs([&] { r = batched_nms(dets, images, opt, &pool); });
+        if (t == 1) base = tp;
+        ok = sameResult(ref, r);
+        allOk = allOk && ok;
+        printf("  ߳ %d | %8.1f ms (x%.2f) %s\n", t, tp, base / tp, ok ? "OK" : "һ");
+    }
+    return allOk ? 0 : 1;
+}
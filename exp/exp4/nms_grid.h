@@ -0,0 +1,210 @@
+#ifndef NMS_GRID_H
+#define NMS_GRID_H
+
+#include <vector>
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include "nms.h"
+
+/*====================================================
+    ٵ NMS
+    IoU > ֵֵ >= 0ҪĽ
+    ԱֻͬһĺȽ
+
+    1.  nms() ͬһ·˳ȫһ
+    2. ӱ߳ȡƽ߳ÿǼǵǵиӣCSR 洢 BoxGrid
+    3. ˳ɨ裺ֻԼǵĸӣ
+       ɨʱ˳ְѴƵĿӸѹ
+    4. ǸӹĴ򵥶һűÿ򶼲һ飻
+       ԼǴʱ˻ɨ
+     nms(boxes, iou_threshold, algo_name) ͬ
+====================================================*/
+
+struct GridNMSStats {
+    long long iou_calls;    // ʵʵ IoU Ĵ
+    int grid_w, grid_h;     // ߴ
+    int large_boxes;        // ŽĿ
+};
+
+/*----------------------------------------------------
+    Ǽǵnms_grid  soft_nms ã
+      ӱ߳ȡƽ߳ sqrt(n) * 4 ڣ
+      ǳ MAX_SPAN ӵĴֻǽ large
+      cells[start[c] .. start[c] + len[c]) Ǹ c 
+      ǼǣȻ򣻵÷ɾ͵ѹ len
+----------------------------------------------------*/
+struct BoxGrid {
+    static const int MAX_SPAN = 16;
+
+    int W, H;
+    vector<int> cx1, cy1, cx2, cy2;   //  r Ŀ򸲸ǵĸӷΧ
+    vector<int> large;                // 
+    vector<int> start, len, cells;
+
+    BoxGrid() : W(0), H(0) {}
+
+    bool is_large(int r) const {
+        return (long long)(cx2[r] - cx1[r] + 1) * (cy2[r] - cy1[r] + 1) > MAX_SPAN;
+    }
+
+    //  r ĿΪ boxes[order[r]]order ǿ
+    void build(const vector<Box> &boxes, const vector<int> &order) {
+        int n = (int)order.size();
+        const Box &b0 = boxes[order[0]];
+        double minX = b0.x1, minY = b0.y1, maxX = b0.x2, maxY = b0.y2;
+        double sumW = 0, sumH = 0;
+        for (int r = 0; r < n; ++r) {
+            const Box &b = boxes[order[r]];
+            minX = min(minX, b.x1);
+            minY = min(minY, b.y1);
+            maxX = max(maxX, b.x2);
+            maxY = max(maxY, b.y2);
+            sumW += max(0.0, b.x2 - b.x1);
+            sumH += max(0.0, b.y2 - b.y1);
+        }
+        double cell = max(sumW, sumH) / n;
+        if (!(cell > 0.0)) cell = 1.0;
+        // ϡ
+        double limit = max(1.0, sqrt((double)n) * 4);
+        double gw = ceil((maxX - minX) / cell), gh = ceil((maxY - minY) / cell);
+        if (!(gw >= 1.0)) gw = 1.0;
+        if (!(gh >= 1.0)) gh = 1.0;
+        if (gw > limit || gh > limit) {
+            double scale = max(gw, gh) / limit;
+            cell *= scale;
+            gw = max(1.0, ceil((maxX - minX) / cell));
+            gh = max(1.0, ceil((maxY - minY) / cell));
+        }
+        W = (int)gw;
+        H = (int)gh;
+
+        cx1.resize(n);
+        cy1.resize(n);
+        cx2.resize(n);
+        cy2.resize(n);
+        large.clear();
+        start.assign((size_t)W * H + 1, 0);
+        for (int r = 0; r < n; ++r) {
+            const Box &b = boxes[order[r]];
+            int a1 = (int)((b.x1 - minX) / cell), b1 = (int)((b.y1 - minY) / cell);
+            int a2 = (int)((b.x2 - minX) / cell), b2 = (int)((b.y2 - minY) / cell);
+            cx1[r] = min(max(a1, 0), W - 1);
+            cy1[r] = min(max(b1, 0), H - 1);
+            cx2[r] = min(max(a2, cx1[r]), W - 1);
+            cy2[r] = min(max(b2, cy1[r]), H - 1);
+            if (is_large(r)) {
+                large.push_back(r);
+                continue;
+            }
+            for (int y = cy1[r]; y <= cy2[r]; ++y)
+                for (int x = cx1[r]; x <= cx2[r]; ++x) start[(size_t)y * W + x + 1]++;
+        }
+        for (size_t c = 0; c < (size_t)W * H; ++c) start[c + 1] += start[c];
+        len.assign((size_t)W * H, 0);
+        cells.resize(start.back());
+        for (int r = 0; r < n; ++r) {
+            if (is_large(r)) continue;
+            for (int y = cy1[r]; y <= cy2[r]; ++y)
+                for (int x = cx1[r]; x <= cx2[r]; ++x) {
+                    size_t c = (size_t)y * W + x;
+                    cells[start[c] + len[c]++] = r;
+                }
+        }
+    }
+};
+
+inline vector<Box> nms_grid(const vector<Box> &boxes,
+                            double iou_threshold,
+                            const string &algo_name,
+                            GridNMSStats *stats = NULL) {
+    int n = (int)boxes.size();
+    if (stats) {
+        stats->iou_calls = 0;
+        stats->grid_w = stats->grid_h = 0;
+        stats->large_boxes = 0;
+    }
+    if (n == 0) return vector<Box>();
+    // ֵΪʱཻĿҲụƣû
+    if (!(iou_threshold >= 0.0)) return nms(boxes, iou_threshold, algo_name);
+
+    vector<int> sorted_idx = sort_indices(boxes, algo_name);
+
+    BoxGrid grid;
+    grid.build(boxes, sorted_idx);
+    const vector<int> &cx1 = grid.cx1, &cy1 = grid.cy1, &cx2 = grid.cx2, &cy2 = grid.cy2;
+    vector<int> &large = grid.large, &start = grid.start, &len = grid.len, &cells = grid.cells;
+    int W = grid.W, H = grid.H;
+
+    vector<bool> suppressed(n, false);
+    vector<int> checked(n, -1);   // checked[j] == i뱣 i ȽϹ
+    vector<int> picked;
+    long long calls = 0;
+    size_t largeLive = large.size();
+
+    for (int i = 0; i < n; ++i) {
+        if (suppressed[i]) continue;
+        const Box &bi = boxes[sorted_idx[i]];
+        picked.push_back(sorted_idx[i]);
+
+        // Ǵֱɨȫ򣬰ӷΧɸ
+        if (grid.is_large(i)) {
+            for (int j = i + 1; j < n; ++j) {
+                if (suppressed[j]) continue;
+                if (cx2[j] < cx1[i] || cx1[j] > cx2[i] || cy2[j] < cy1[i] || cy1[j] > cy2[i]) continue;
+                calls++;
+                if (IoU(bi, boxes[sorted_idx[j]]) > iou_threshold) suppressed[j] = true;
+            }
+            continue;
+        }
+
+        for (int y = cy1[i]; y <= cy2[i]; ++y) {
+            for (int x = cx1[i]; x <= cx2[i]; ++x) {
+                size_t c = (size_t)y * W + x;
+                int *list = &cells[0] + start[c];
+                int keep = 0;
+                for (int k = 0; k < len[c]; ++k) {
+                    int j = list[k];
+                    if (j <= i || suppressed[j]) continue;   // ԺҲò
+                    list[keep++] = j;
+                    if (checked[j] == i) continue;
+                    checked[j] = i;
+                    calls++;
+                    if (IoU(bi, boxes[sorted_idx[j]]) > iou_threshold) {
+                        suppressed[j] = true;
+                        keep--;
+                    }
+                }
+                len[c] = keep;
+            }
+        }
+
+        // ͬѹ
+        size_t keep = 0;
+        for (size_t k = 0; k < largeLive; ++k) {
+            int j = large[k];
+            if (j <= i || suppressed[j]) continue;
+            large[keep++] = j;
+            calls++;
+            if (IoU(bi, boxes[sorted_idx[j]]) > iou_threshold) {
+                suppressed[j] = true;
+                keep--;
+            }
+        }
+        largeLive = keep;
+    }
+
+    if (stats) {
+        stats->iou_calls = calls;
+        stats->grid_w = W;
+        stats->grid_h = H;
+        stats->large_boxes = (int)large.size();
+    }
+    vector<Box> result;
+    result.reserve(picked.size());
+    for (size_t k = 0; k < picked.size(); ++k) result.push_back(boxes[picked[k]]);
+    return result;
+}
+
+#endif
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "nms.h"
+#include "nms_grid.h"
+
+using namespace std;
+
+/*====================================================
+     NMS  nms() Ա
+    ֲַgenerate_random_boxes / generate_clustered_boxes
+    N = 100 ~ 100000ֵ 0.5˶ͬ
+    nms()  IoU ôͬѭ
+    룺g++ -O2 nms_grid_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+// nms()  IoU ô
+static long long bruteCalls(const vector<Box> &boxes, double thr) {
+    int n = (int)boxes.size();
+    vector<int> idx = quick_sort_indices(boxes);
+    vector<bool> suppressed(n, false);
+    long long calls = 0;
+    for (int i = 0; i < n; ++i) {
+        if (suppressed[i]) continue;
+        for (int j = i + 1; j < n; ++j) {
+            if (suppressed[j]) continue;
+            calls++;
+            if (IoU(boxes[idx[i]], boxes[idx[j]]) > thr) suppressed[j] = true;
+        }
+    }
+    return calls;
+}
+
+static bool sameBoxes(const vector<Box> &a, const vector<Box> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].x1 != b[i].x1 || a[i].y1 != b[i].y1 || a[i].x2 != b[i].x2 ||
+            a[i].y2 != b[i].y2 || a[i].score != b[i].score)
+            return false;
+    return true;
+}
+
+int main() {
+    srand(2025);
+    const double thr = 0.5;
+    int sizes[] = {100, 1000, 10000, 50000, 100000};
+    const char *dists[] = {"random", "clustered"};
+    bool allOk = true;
+
+    cout << "====  NMS vs nms()quick ֵ 0.5====" << endl;
+    for (int d = 0; d < 2; ++d) {
+        printf("\n=== ݷֲ: %s ===\n", dists[d]);
+        for (int si = 0; si < 5; ++si) {
+            int n = sizes[si];
+            vector<Box> boxes = d == 0 ? generate_random_boxes(n) : generate_clustered_boxes(n);
+
+            vector<Box> ref, got;
+            double tb = timeMs([&] { ref = nms(boxes, thr, "quick"); });
+            GridNMSStats st;
+            double tg = timeMs([&] { got = nms_grid(boxes, thr, "quick", &st); });
+            long long bc = bruteCalls(boxes, thr);
+            bool ok = sameBoxes(ref, got);
+            allOk = allOk && ok;
+            printf("N = %6d | nms %9.2f ms, IoU %11lld  | grid %7.2f ms, IoU %9lld ,  %3dx%-3d"
+                   " | x%6.1f |  %5zu  %s\n",
+                   n, tb, bc, tg, st.iou_calls, st.grid_w, st.grid_h, tb / tg, got.size(),
+                   ok ? "OK" : "һ");
+        }
+    }
+
+    // ·ҲӦһ
+    vector<Box> boxes = generate_clustered_boxes(5000);
+    const char *algos[] = {"merge", "heap", "insertion"};
+    for (int a = 0; a < 3; ++a) {
+        bool ok = sameBoxes(nms(boxes, thr, algos[a]), nms_grid(boxes, thr, algos[a]));
+        allOk = allOk && ok;
+        printf(" %-9s N = 5000 clustered  %s\n", algos[a], ok ? "OK" : "һ");
+    }
+    // ͼĴ
+    boxes = generate_random_boxes(20000);
+    for (int k = 0; k < 50; ++k) {
+        Box b = {0, 0, 1000.0 - k, 1000.0 - k, (double)rand() / RAND_MAX};
+        boxes.push_back(b);
+    }
+    for (int t = 0; t < 3; ++t) {
+        double th = t == 0 ? 0.0 : t == 1 ? 0.3 : 0.7;
+        bool ok = sameBoxes(nms(boxes, th, "quick"), nms_grid(boxes, th, "quick"));
+        allOk = allOk && ok;
+        printf(" N = 20050  ֵ %.1f  %s\n", th, ok ? "OK" : "һ");
+    }
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,162 @@
+#ifndef NMS_PARALLEL_H
+#define NMS_PARALLEL_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_simd.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    ߳ NMS
+      nms_parallel_matrix : ƾг 64  x  32 пƬ
+                            ̳߳ض̬ȡ̰̰߳ɨ
+      nms_parallel        :  64 һƽ˳ж
+                            ٰѱ鱣жԺпָ̼߳㣬
+                            ֻ߳дԼп飬
+                            Ƶв㣬ʺϴ󲿷ֿᱻƵ
+    ߵı nms() ͬ
+    radix_sort_indices_parallel : л򣬽 radix_sort_indices ͬ
+====================================================*/
+
+// п rb ȫжп [cb0, cb1) 
+inline void build_mask_tile(const BoxBatch &b, double thr, int rb, int cb0, int cb1, SuppressionMask &mask) {
+    int end = min(b.n, rb * 64 + 64);
+    for (int i = rb * 64; i < end; ++i) {
+        uint64_t *row = mask.row(i);
+        for (int cb = cb0; cb < cb1; ++cb)
+            row[cb - rb] = iou_mask64(b, i, cb * 64, thr) & later_bits(b, i, cb);
+    }
+}
+
+inline vector<Box> nms_parallel_matrix(const vector<Box> &boxes, double iou_threshold,
+                                       const string &algo_name, MySTL::ThreadPool &pool) {
+    if (boxes.empty()) return vector<Box>();
+    BoxBatch b;
+    b.load(boxes, sort_indices(boxes, algo_name));
+    SuppressionMask mask;
+    mask.resize(b.blocks);
+
+    // Ƭ嵥ÿеĹͬС̬ž
+    const int span = 32;
+    vector<int> tileRow, tileCol;
+    for (int rb = 0; rb < b.blocks; ++rb)
+        for (int cb = rb; cb < b.blocks; cb += span) {
+            tileRow.push_back(rb);
+            tileCol.push_back(cb);
+        }
+    pool.parallelFor(tileRow.size(), 1, [&](size_t t0, size_t t1, int) {
+        for (size_t t = t0; t < t1; ++t)
+            build_mask_tile(b, iou_threshold, tileRow[t], tileCol[t],
+                            min(b.blocks, tileCol[t] + span), mask);
+    });
+    return gather_picked(boxes, b, sweep_mask(b, mask));
+}
+
+inline vector<Box> nms_parallel(const vector<Box> &boxes, double iou_threshold,
+                                const string &algo_name, MySTL::ThreadPool &pool) {
+    if (boxes.empty()) return vector<Box>();
+    BoxBatch b;
+    b.load(boxes, sort_indices(boxes, algo_name));
+    vector<uint64_t> removed(b.blocks, 0);
+    vector<int> kept, fresh;
+
+    for (int rb = 0; rb < b.blocks; ++rb) {
+        // 1. ˳жǰӰ removed öԽƬ
+        fresh.clear();
+        int end = min(b.n, rb * 64 + 64);
+        for (int i = rb * 64; i < end; ++i) {
+            if (removed[rb] >> (i % 64) & 1) continue;
+            fresh.push_back(i);
+            removed[rb] |= iou_mask64(b, i, rb * 64, iou_threshold) & later_bits(b, i, rb);
+        }
+        kept.insert(kept.end(), fresh.begin(), fresh.end());
+        if (fresh.empty() || rb + 1 == b.blocks) continue;
+
+        // 2. 鱣жԺп룬пָ߳
+        size_t cols = (size_t)(b.blocks - rb - 1);
+        size_t grain = max((size_t)1, (size_t)256 / fresh.size());   // ÿԼ 256  64 ·
+        pool.parallelFor(cols, grain, [&](size_t c0, size_t c1, int) {
+            for (size_t c = c0; c < c1; ++c) {
+                int cb = rb + 1 + (int)c;
+                uint64_t live = b.valid_bits(cb) & ~removed[cb];
+                for (size_t k = 0; k < fresh.size() && live; ++k) {
+                    uint64_t hit = iou_mask64(b, fresh[k], cb * 64, iou_threshold) & live;
+                    removed[cb] |= hit;
+                    live &= ~hit;
+                }
+            }
+        });
+    }
+    return gather_picked(boxes, b, kept);
+}
+
+/*----------------------------------------------------
+     LSD 򣨼Ĺ졢ͬ radix_sort_indices
+    ÿ̶̹߳һļֱͼ
+    (Ͱ, ߳) ˳ǰ׺õдλãٸԷַȶ
+----------------------------------------------------*/
+inline vector<int> radix_sort_indices_parallel(const vector<Box> &boxes, MySTL::ThreadPool &pool) {
+    int n = (int)boxes.size();
+    vector<int> idx(n);
+    if (n == 0) return idx;
+    int T = pool.size();
+    if (n < 4096 * T) return radix_sort_indices(boxes);   // ̫Сֵò
+    const size_t buckets = (size_t)1 << RADIX_BITS;
+    int idxBits = radix_index_bits(n);
+    vector<uint64_t> keys(n), tmp(n);
+    vector<size_t> hist((size_t)T * buckets);
+    vector<char> skip(RADIX_PASSES, 0);
+
+    // ȫ˵ֱͼһ㣬Щ˿
+    {
+        vector<size_t> all((size_t)T * buckets * RADIX_PASSES, 0);
+        pool.run([&](int t) {
+            size_t b = (size_t)n * t / T, e = (size_t)n * (t + 1) / T;
+            size_t *h = &all[(size_t)t * buckets * RADIX_PASSES];
+            for (size_t i = b; i < e; ++i) {
+                uint64_t k = radix_key(boxes, (int)i, idxBits);
+                keys[i] = k;
+                for (int p = 0; p < RADIX_PASSES; ++p) h[p * buckets + ((k >> (p * RADIX_BITS)) & (buckets - 1))]++;
+            }
+        });
+        for (int p = 0; p < RADIX_PASSES; ++p) {
+            size_t d = (keys[0] >> (p * RADIX_BITS)) & (buckets - 1), c = 0;
+            for (int t = 0; t < T; ++t) c += all[(size_t)t * buckets * RADIX_PASSES + p * buckets + d];
+            skip[p] = c == (size_t)n;
+        }
+    }
+
+    for (int p = 0; p < RADIX_PASSES; ++p) {
+        if (skip[p]) continue;
+        int shift = p * RADIX_BITS;
+        pool.run([&](int t) {
+            size_t b = (size_t)n * t / T, e = (size_t)n * (t + 1) / T;
+            size_t *h = &hist[(size_t)t * buckets];
+            std::fill(h, h + buckets, (size_t)0);
+            for (size_t i = b; i < e; ++i) h[(keys[i] >> shift) & (buckets - 1)]++;
+        });
+        size_t sum = 0;
+        for (size_t d = 0; d < buckets; ++d)
+            for (int t = 0; t < T; ++t) {
+                size_t c = hist[(size_t)t * buckets + d];
+                hist[(size_t)t * buckets + d] = sum;
+                sum += c;
+            }
+        pool.run([&](int t) {
+            size_t b = (size_t)n * t / T, e = (size_t)n * (t + 1) / T;
+            size_t *h = &hist[(size_t)t * buckets];
+            for (size_t i = b; i < e; ++i) tmp[h[(keys[i] >> shift) & (buckets - 1)]++] = keys[i];
+        });
+        keys.swap(tmp);
+    }
+    uint64_t mask = ((uint64_t)1 << idxBits) - 1;
+    for (int i = 0; i < n; ++i) idx[i] = (int)(keys[i] & mask);
+    radix_fix_ties(idx, keys, idxBits, boxes);
+    return idx;
+}
+
+#endif
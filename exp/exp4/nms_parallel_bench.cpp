@@ -0,0 +1,77 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <thread>
+
+#include "nms.h"
+#include "nms_simd.h"
+#include "nms_parallel.h"
+
+using namespace std;
+
+/*====================================================
+    ߳ NMS չԣN = 10^4 / 10^5ֲַ1~16 ߳
+      matrix : nms_parallel_matrixƬ + ˳ɨ
+      lazy   : nms_parallelпƽֻ㱣
+    ̻߳׼Ϊ nms()N = 10^5 random Լ룩 nms_simd
+    룺g++ -O2 -mavx2 -pthread nms_parallel_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static bool sameBoxes(const vector<Box> &a, const vector<Box> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].x1 != b[i].x1 || a[i].y1 != b[i].y1 || a[i].x2 != b[i].x2 ||
+            a[i].y2 != b[i].y2 || a[i].score != b[i].score)
+            return false;
+    return true;
+}
+
+int main() {
+    srand(2025);
+    const double thr = 0.5;
+    int sizes[] = {10000, 100000};
+    const char *dists[] = {"random", "clustered"};
+    bool allOk = true;
+
+    printf("==== ߳ NMSں %sӲ߳ %u====\n", nms_simd_kernel_name(),
+           thread::hardware_concurrency());
+    for (int d = 0; d < 2; ++d) {
+        for (int si = 0; si < 2; ++si) {
+            int n = sizes[si];
+            vector<Box> boxes = d == 0 ? generate_random_boxes(n) : generate_clustered_boxes(n);
+            vector<Box> ref, simd;
+            double tr = timeMs([&] { ref = nms(boxes, thr, "quick"); });
+            double ts = timeMs([&] { simd = nms_simd(boxes, thr, "quick"); });
+            bool ok = sameBoxes(ref, simd);
+            printf("\n%s N = %d | nms %.1f ms | nms_simd %.1f ms |  %zu\n", dists[d], n, tr, ts, ref.size());
+
+            double base[2] = {0, 0};
+            for (int t = 1; t <= 16; t *= 2) {
+                MySTL::ThreadPool pool(t);
+                vector<Box> a, b;
+                double tm = timeMs([&] { a = nms_parallel_matrix(boxes, thr, "quick", pool); });
+                double tl = timeMs([&] { b = nms_parallel(boxes, thr, "quick", pool); });
+                if (t == 1) {
+                    base[0] = tm;
+                    base[1] = tl;
+                }
+                bool same = sameBoxes(ref, a) && sameBoxes(ref, b);
+                ok = ok && same;
+                printf("  ߳ %2d | matrix %9.1f ms (x%.2f) | lazy %8.1f ms (x%.2f,  nms x%.1f) %s\n",
+                       t, tm, base[0] / tm, tl, base[1] / tl, tr / tl, same ? "OK" : "һ");
+            }
+            allOk = allOk && ok;
+        }
+    }
+    return allOk ? 0 : 1;
+}
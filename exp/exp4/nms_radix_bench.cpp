@@ -0,0 +1,103 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_parallel.h"
+
+using namespace std;
+
+/*====================================================
+    Աȣquick / merge / heap / insertion / radix /  radix
+      N = 10^3 ~ 10^6random ֲֲ޹أֻ
+      insertion ֻܵ 10^4
+    ȷԣ밴radix 밴 (, ±)
+     std::sort ͬnms(..., "radix")  nms(..., "quick") ͬ
+    룺g++ -O2 -pthread nms_radix_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static bool descending(const vector<Box> &boxes, const vector<int> &idx) {
+    if (idx.size() != boxes.size()) return false;
+    vector<char> seen(idx.size(), 0);
+    for (size_t i = 0; i < idx.size(); ++i) {
+        if (idx[i] < 0 || idx[i] >= (int)idx.size() || seen[idx[i]]) return false;
+        seen[idx[i]] = 1;
+        if (i && boxes[idx[i - 1]].score < boxes[idx[i]].score) return false;
+    }
+    return true;
+}
+
+static bool sameBoxes(const vector<Box> &a, const vector<Box> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].x1 != b[i].x1 || a[i].y1 != b[i].y1 || a[i].x2 != b[i].x2 ||
+            a[i].y2 != b[i].y2 || a[i].score != b[i].score)
+            return false;
+    return true;
+}
+
+int main() {
+    srand(2025);
+    bool allOk = true;
+    int sizes[] = {1000, 10000, 100000, 1000000};
+    MySTL::ThreadPool pool(4);
+
+    printf("==== ms radix  %d ̣߳====\n", pool.size());
+    printf("%8s %9s %9s %9s %9s %9s %9s %9s\n", "N", "quick", "merge", "heap", "insertion", "radix", "radix-par",
+           "std::sort");
+    for (int si = 0; si < 4; ++si) {
+        int n = sizes[si];
+        vector<Box> boxes = generate_random_boxes(n);
+        // ΪһЩظͬʱ±˳
+        for (int i = 0; i < n / 10; ++i) boxes[rand() % n].score = boxes[rand() % n].score;
+
+        vector<int> ref(n);
+        for (int i = 0; i < n; ++i) ref[i] = i;
+        double tstd = timeMs([&] {
+            std::sort(ref.begin(), ref.end(), [&](int a, int b) {
+                return boxes[a].score != boxes[b].score ? boxes[a].score > boxes[b].score : a < b;
+            });
+        });
+
+        string algos[] = {"quick", "merge", "heap", "insertion", "radix"};
+        printf("%8d", n);
+        bool ok = true;
+        for (int a = 0; a < 5; ++a) {
+            if (algos[a] == "insertion" && n > 10000) {
+                printf(" %9s", "-");
+                continue;
+            }
+            vector<int> idx;
+            double t = timeMs([&] { idx = sort_indices(boxes, algos[a]); });
+            ok = ok && descending(boxes, idx);
+            if (algos[a] == "radix") ok = ok && idx == ref;
+            printf(" %9.2f", t);
+        }
+        vector<int> par;
+        double tp = timeMs([&] { par = radix_sort_indices_parallel(boxes, pool); });
+        ok = ok && par == ref;
+        printf(" %9.2f %9.2f %s\n", tp, tstd, ok ? "OK" : "һ");
+        allOk = allOk && ok;
+    }
+
+    printf("\n==== nms(\"radix\")  nms(\"quick\")clusteredN = 10000====\n");
+    vector<Box> boxes = generate_clustered_boxes(10000);
+    vector<Box> a, b;
+    double ta = timeMs([&] { a = nms(boxes, 0.5, "quick"); });
+    double tb = timeMs([&] { b = nms(boxes, 0.5, "radix"); });
+    bool ok = sameBoxes(a, b);
+    allOk = allOk && ok;
+    printf("quick %.1f ms | radix %.1f ms |  %zu %s\n", ta, tb, b.size(), ok ? "OK" : "һ");
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,259 @@
+#ifndef NMS_SIMD_H
+#define NMS_SIMD_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+// GCC 12  avx512fintrin.h  _mm512_undefined_pd δʼ
+// ֻͷļΧڹصӰ
+#if defined(__AVX512F__) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#if defined(__AVX512F__) && defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#include "nms.h"
+
+/*====================================================
+    SoA  + SIMD IoU + λ NMS
+      BoxBatch     : ˳źõ x1/y1/x2/y2/ 飬
+                     뵽 64 ı
+      iou_mask64   : һ 64 ѡһ "IoU > ֵ" λ룬
+                     AVX-512 һ 8 AVX2 һ 4 double
+      nms_simd     : ֻΪУ 64 λֲƼ
+      nms_bitmask  : GPU ʽȷֿ齨ƾ̰ɨ
+
+     IoU() ͬ˫㣬 nms() ͬ
+    Ϊ˲ñѳ˼ϳ FMA
+     -mavx2  -mavx512fҪ -mfma / -march=native
+    ߼ -ffp-contract=off
+====================================================*/
+
+inline const char *nms_simd_kernel_name() {
+#if defined(__AVX512F__)
+    return "AVX-512";
+#elif defined(__AVX2__)
+    return "AVX2";
+#else
+    return "scalar";
+#endif
+}
+
+struct BoxBatch {
+    int n;        // ʵʿ
+    int blocks;   // 64 һĿ
+    vector<double> x1, y1, x2, y2, area;
+    vector<int> index;   //  -> ԭ±
+
+    BoxBatch() : n(0), blocks(0) {}
+
+    // order Ϊ±ꣻĿտΪ 0˭ཻ
+    void load(const vector<Box> &boxes, const vector<int> &order) {
+        n = (int)order.size();
+        blocks = (n + 63) / 64;
+        size_t m = (size_t)blocks * 64;
+        x1.assign(m, 0.0);
+        y1.assign(m, 0.0);
+        x2.assign(m, 0.0);
+        y2.assign(m, 0.0);
+        area.assign(m, 0.0);
+        index = order;
+        for (int r = 0; r < n; ++r) {
+            const Box &b = boxes[order[r]];
+            x1[r] = b.x1;
+            y1[r] = b.y1;
+            x2[r] = b.x2;
+            y2[r] = b.y2;
+            area[r] = (b.x2 - b.x1) * (b.y2 - b.y1);
+        }
+    }
+
+    //  cb ʵڵĿ
+    uint64_t valid_bits(int cb) const {
+        int rest = n - cb * 64;
+        return rest >= 64 ? ~0ULL : ((1ULL << rest) - 1);
+    }
+};
+
+/*----------------------------------------------------
+     i Ŀ j0..j0+63 Ŀ򣺵 k λΪ IoU > thr
+    IoU() ޽򲢼ʱ 0ֵΪʱЩҲ
+----------------------------------------------------*/
+inline uint64_t iou_mask64(const BoxBatch &b, int i, int j0, double thr) {
+    const double ax1 = b.x1[i], ay1 = b.y1[i], ax2 = b.x2[i], ay2 = b.y2[i], aa = b.area[i];
+    uint64_t bits = 0;
+#if defined(__AVX512F__)
+    const bool neg = thr < 0.0;
+    const __m512d vx1 = _mm512_set1_pd(ax1), vy1 = _mm512_set1_pd(ay1);
+    const __m512d vx2 = _mm512_set1_pd(ax2), vy2 = _mm512_set1_pd(ay2);
+    const __m512d va = _mm512_set1_pd(aa), vt = _mm512_set1_pd(thr), zero = _mm512_setzero_pd();
+    for (int k = 0; k < 64; k += 8) {
+        int j = j0 + k;
+        __m512d xx1 = _mm512_max_pd(vx1, _mm512_loadu_pd(&b.x1[j]));
+        __m512d yy1 = _mm512_max_pd(vy1, _mm512_loadu_pd(&b.y1[j]));
+        __m512d xx2 = _mm512_min_pd(vx2, _mm512_loadu_pd(&b.x2[j]));
+        __m512d yy2 = _mm512_min_pd(vy2, _mm512_loadu_pd(&b.y2[j]));
+        __m512d w = _mm512_max_pd(zero, _mm512_sub_pd(xx2, xx1));
+        __m512d h = _mm512_max_pd(zero, _mm512_sub_pd(yy2, yy1));
+        __m512d inter = _mm512_mul_pd(w, h);
+        __m512d uni = _mm512_sub_pd(_mm512_add_pd(va, _mm512_loadu_pd(&b.area[j])), inter);
+        __mmask8 ok = _mm512_cmp_pd_mask(inter, zero, _CMP_GT_OQ) & _mm512_cmp_pd_mask(uni, zero, _CMP_GT_OQ);
+        __mmask8 hit = _mm512_mask_cmp_pd_mask(ok, _mm512_div_pd(inter, uni), vt, _CMP_GT_OQ);
+        if (neg) hit |= (__mmask8)~ok;
+        bits |= (uint64_t)hit << k;
+    }
+#elif defined(__AVX2__)
+    const bool neg = thr < 0.0;
+    const __m256d vx1 = _mm256_set1_pd(ax1), vy1 = _mm256_set1_pd(ay1);
+    const __m256d vx2 = _mm256_set1_pd(ax2), vy2 = _mm256_set1_pd(ay2);
+    const __m256d va = _mm256_set1_pd(aa), vt = _mm256_set1_pd(thr), zero = _mm256_setzero_pd();
+    for (int k = 0; k < 64; k += 4) {
+        int j = j0 + k;
+        __m256d xx1 = _mm256_max_pd(vx1, _mm256_loadu_pd(&b.x1[j]));
+        __m256d yy1 = _mm256_max_pd(vy1, _mm256_loadu_pd(&b.y1[j]));
+        __m256d xx2 = _mm256_min_pd(vx2, _mm256_loadu_pd(&b.x2[j]));
+        __m256d yy2 = _mm256_min_pd(vy2, _mm256_loadu_pd(&b.y2[j]));
+        __m256d w = _mm256_max_pd(zero, _mm256_sub_pd(xx2, xx1));
+        __m256d h = _mm256_max_pd(zero, _mm256_sub_pd(yy2, yy1));
+        __m256d inter = _mm256_mul_pd(w, h);
+        __m256d uni = _mm256_sub_pd(_mm256_add_pd(va, _mm256_loadu_pd(&b.area[j])), inter);
+        __m256d ok = _mm256_and_pd(_mm256_cmp_pd(inter, zero, _CMP_GT_OQ), _mm256_cmp_pd(uni, zero, _CMP_GT_OQ));
+        __m256d hit = _mm256_and_pd(ok, _mm256_cmp_pd(_mm256_div_pd(inter, uni), vt, _CMP_GT_OQ));
+        int m = _mm256_movemask_pd(hit);
+        if (neg) m |= ~_mm256_movemask_pd(ok) & 0xF;
+        bits |= (uint64_t)m << k;
+    }
+#else
+    for (int k = 0; k < 64; ++k) {
+        int j = j0 + k;
+        double xx1 = max(ax1, b.x1[j]);
+        double yy1 = max(ay1, b.y1[j]);
+        double xx2 = min(ax2, b.x2[j]);
+        double yy2 = min(ay2, b.y2[j]);
+        double w = max(0.0, xx2 - xx1);
+        double h = max(0.0, yy2 - yy1);
+        double inter = w * h;
+        double uni = aa + b.area[j] - inter;
+        double iou = (inter <= 0.0 || uni <= 0.0) ? 0.0 : inter / uni;
+        if (iou > thr) bits |= 1ULL << k;
+    }
+#endif
+    return bits;
+}
+
+//  cb  i ֮ʵڵĿ
+inline uint64_t later_bits(const BoxBatch &b, int i, int cb) {
+    uint64_t m = b.valid_bits(cb);
+    if (cb == i / 64) m &= ~((2ULL << (i % 64)) - 1);
+    return m;
+}
+
+inline vector<Box> gather_picked(const vector<Box> &boxes, const BoxBatch &b, const vector<int> &keptRanks) {
+    vector<Box> result;
+    result.reserve(keptRanks.size());
+    for (size_t k = 0; k < keptRanks.size(); ++k) result.push_back(boxes[b.index[keptRanks[k]]]);
+    return result;
+}
+
+/*----------------------------------------------------
+    ֻΪ룺ƵԶò
+    removed  64 λּ¼ƵƵĿֱ
+    ׷ӵ keptremoved Ϊɸ
+----------------------------------------------------*/
+inline void nms_simd_ranks(const BoxBatch &b, double iou_threshold,
+                           vector<uint64_t> &removed, vector<int> &kept) {
+    removed.assign(b.blocks, 0);
+    for (int i = 0; i < b.n; ++i) {
+        if (removed[i / 64] >> (i % 64) & 1) continue;
+        kept.push_back(i);
+        for (int cb = i / 64; cb < b.blocks; ++cb) {
+            uint64_t live = later_bits(b, i, cb) & ~removed[cb];
+            if (live) removed[cb] |= iou_mask64(b, i, cb * 64, iou_threshold) & live;
+        }
+    }
+}
+
+inline vector<Box> nms_simd(const vector<Box> &boxes, double iou_threshold, const string &algo_name) {
+    if (boxes.empty()) return vector<Box>();
+    BoxBatch b;
+    b.load(boxes, sort_indices(boxes, algo_name));
+    vector<uint64_t> removed;
+    vector<int> kept;
+    nms_simd_ranks(b, iou_threshold, removed, kept);
+    return gather_picked(boxes, b, kept);
+}
+
+/*----------------------------------------------------
+    ƾ󣺰 64 һţ
+     rb ĵ r ֻп rb..blocks-1
+----------------------------------------------------*/
+struct SuppressionMask {
+    int blocks;
+    vector<size_t> base;     // ÿпʼ
+    vector<uint64_t> words;
+
+    SuppressionMask() : blocks(0) {}
+
+    void resize(int nb) {
+        blocks = nb;
+        base.assign(nb + 1, 0);
+        for (int rb = 0; rb < nb; ++rb) base[rb + 1] = base[rb] + (size_t)64 * (nb - rb);
+        words.assign(base[nb], 0);
+    }
+
+    uint64_t *row(int i) {
+        int rb = i / 64;
+        return &words[0] + base[rb] + (size_t)(i % 64) * (blocks - rb);
+    }
+
+    const uint64_t *row(int i) const {
+        int rb = i / 64;
+        return &words[0] + base[rb] + (size_t)(i % 64) * (blocks - rb);
+    }
+};
+
+// п [rb0, rb1) ȫ֣п黥ɣɷָͬ߳
+inline void build_mask_rows(const BoxBatch &b, double thr, int rb0, int rb1, SuppressionMask &mask) {
+    for (int rb = rb0; rb < rb1; ++rb) {
+        int end = min(b.n, rb * 64 + 64);
+        for (int i = rb * 64; i < end; ++i) {
+            uint64_t *row = mask.row(i);
+            for (int cb = rb; cb < b.blocks; ++cb)
+                row[cb - rb] = iou_mask64(b, i, cb * 64, thr) & later_bits(b, i, cb);
+        }
+    }
+}
+
+// ̰ɨ裺в removed 64 λֲ
+inline vector<int> sweep_mask(const BoxBatch &b, const SuppressionMask &mask) {
+    vector<uint64_t> removed(b.blocks, 0);
+    vector<int> kept;
+    for (int i = 0; i < b.n; ++i) {
+        if (removed[i / 64] >> (i % 64) & 1) continue;
+        kept.push_back(i);
+        const uint64_t *row = mask.row(i);
+        int rb = i / 64;
+        for (int cb = rb; cb < b.blocks; ++cb) removed[cb] |= row[cb - rb];
+    }
+    return kept;
+}
+
+// ڴԼ N^2 / 16 ֽڣN = 50000 ʱԼ 160MB
+inline vector<Box> nms_bitmask(const vector<Box> &boxes, double iou_threshold, const string &algo_name) {
+    if (boxes.empty()) return vector<Box>();
+    BoxBatch b;
+    b.load(boxes, sort_indices(boxes, algo_name));
+    SuppressionMask mask;
+    mask.resize(b.blocks);
+    build_mask_rows(b, iou_threshold, 0, b.blocks, mask);
+    return gather_picked(boxes, b, sweep_mask(b, mask));
+}
+
+#endif
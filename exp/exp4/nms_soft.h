@@ -0,0 +1,221 @@
+#ifndef NMS_SOFT_H
+#define NMS_SOFT_H
+
+#include <vector>
+#include <cmath>
+#include <queue>
+#include <string>
+#include <utility>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_grid.h"
+
+/*====================================================
+    Soft-NMS Ԥɸ
+      prefilter_indices : ڷֵĿ nth_element
+                          ѡߵ k ȫ
+      nms_prefiltered   : Ԥɸ nms()ֻµĺѡ
+      soft_nms          :  / ˹˥ Soft-NMS
+        1. ȡǰߵĺѡֻ½ľɼ
+           Ͻ磬ʱֹٰ·Żأÿͬһʱֻڶһ
+        2. ѡǼǵѡһֻǵ
+           ӣֻнĺѡ´
+        3. ˥ֵµĿֱ̭
+      soft_nms_reference : ֵ O(N^2) дУ
+     Soft-NMS ȫͬ
+====================================================*/
+
+enum SoftNMSMethod { SOFT_NMS_LINEAR, SOFT_NMS_GAUSSIAN };
+
+struct SoftNMSOptions {
+    SoftNMSMethod method;
+    double iou_threshold;      // ˥IoU ˥
+    double sigma;              // ˹˥s *= exp(-IoU^2 / sigma)
+    double score_threshold;    // Ŀ
+    int pre_topk;              // ֻȡʼߵ k 룬0 
+    int max_output;            // ѡôǰ0 
+
+    SoftNMSOptions()
+        : method(SOFT_NMS_GAUSSIAN), iou_threshold(0.3), sigma(0.5), score_threshold(0.001),
+          pre_topk(0), max_output(0) {}
+};
+
+struct SoftNMSStats {
+    long long iou_calls;    // ʵʼ IoU Ĵ
+    long long rescored;     // дĴ
+};
+
+// ±
+struct SoftScoreGreater {
+    const vector<Box> *boxes;
+    bool operator()(int a, int b) const {
+        double sa = (*boxes)[a].score, sb = (*boxes)[b].score;
+        return sa != sb ? sa > sb : a < b;
+    }
+};
+
+// ·ֵĿȡǰ pre_topk ±
+inline vector<int> prefilter_indices(const vector<Box> &boxes, double score_threshold, int pre_topk) {
+    vector<int> idx;
+    idx.reserve(boxes.size());
+    for (int i = 0; i < (int)boxes.size(); ++i)
+        if (boxes[i].score >= score_threshold) idx.push_back(i);
+    if (pre_topk > 0 && (int)idx.size() > pre_topk) {
+        SoftScoreGreater cmp = {&boxes};
+        std::nth_element(idx.begin(), idx.begin() + (pre_topk - 1), idx.end(), cmp);
+        idx.resize(pre_topk);
+    }
+    return idx;
+}
+
+// Ӳ NMS Ԥɸ汾ֵΪ -inf  pre_topk Ϊ 0 ʱ nms() ͬ
+inline vector<Box> nms_prefiltered(const vector<Box> &boxes, double iou_threshold, double score_threshold,
+                                   int pre_topk, const string &algo_name) {
+    vector<int> idx = prefilter_indices(boxes, score_threshold, pre_topk);
+    std::sort(idx.begin(), idx.end());   // ԭ˳㷨 nms() һ
+    vector<Box> sub;
+    sub.reserve(idx.size());
+    for (size_t k = 0; k < idx.size(); ++k) sub.push_back(boxes[idx[k]]);
+    return nms(sub, iou_threshold, algo_name);
+}
+
+inline double soft_nms_weight(const SoftNMSOptions &opt, double iou) {
+    if (opt.method == SOFT_NMS_LINEAR) return iou > opt.iou_threshold ? 1.0 - iou : 1.0;
+    return std::exp(-(iou * iou) / opt.sigma);
+}
+
+inline vector<Box> soft_nms_reference(const vector<Box> &boxes, const SoftNMSOptions &opt) {
+    vector<int> idx = prefilter_indices(boxes, opt.score_threshold, opt.pre_topk);
+    std::sort(idx.begin(), idx.end());
+    vector<Box> live;
+    for (size_t k = 0; k < idx.size(); ++k) live.push_back(boxes[idx[k]]);
+    vector<int> id(idx);
+    vector<Box> result;
+    while (!live.empty() && (opt.max_output <= 0 || (int)result.size() < opt.max_output)) {
+        size_t best = 0;
+        for (size_t k = 1; k < live.size(); ++k)
+            if (live[k].score > live[best].score || (live[k].score == live[best].score && id[k] < id[best]))
+                best = k;
+        Box b = live[best];
+        result.push_back(b);
+        live.erase(live.begin() + best);
+        id.erase(id.begin() + best);
+        size_t keep = 0;
+        for (size_t k = 0; k < live.size(); ++k) {
+            double iou = IoU(b, live[k]);
+            if (iou > 0) live[k].score *= soft_nms_weight(opt, iou);
+            if (live[k].score < opt.score_threshold) continue;
+            live[keep] = live[k];
+            id[keep++] = id[k];
+        }
+        live.resize(keep);
+        id.resize(keep);
+    }
+    return result;
+}
+
+inline vector<Box> soft_nms(const vector<Box> &boxes, const SoftNMSOptions &opt, SoftNMSStats *stats = NULL) {
+    if (stats) stats->iou_calls = stats->rescored = 0;
+    vector<int> idx = prefilter_indices(boxes, opt.score_threshold, opt.pre_topk);
+    int n = (int)idx.size();
+    if (n == 0) return vector<Box>();
+
+    // ѡ뵱ǰ
+    vector<Box> cand(n);
+    vector<double> score(n);
+    for (int r = 0; r < n; ++r) {
+        cand[r] = boxes[idx[r]];
+        score[r] = cand[r].score;
+    }
+
+    //  nms_grid ͬһ׽
+    BoxGrid grid;
+    grid.build(boxes, idx);
+    const vector<int> &cx1 = grid.cx1, &cy1 = grid.cy1, &cx2 = grid.cx2, &cy2 = grid.cy2;
+    vector<int> &large = grid.large, &start = grid.start, &len = grid.len, &cells = grid.cells;
+    int W = grid.W;
+
+    // д (, -ԭ±)ͬʱԭ±Сȳοʵһ
+    // ´ʱѣʱּٰǰŻ
+    typedef pair<double, int> Item;
+    std::priority_queue<Item> heap;
+    for (int r = 0; r < n; ++r) heap.push(Item(score[r], -idx[r]));
+    vector<int> rankOf;   // ԭ± -> ѡţֻڳʱ
+    {
+        int top = 0;
+        for (int r = 0; r < n; ++r) top = max(top, idx[r] + 1);
+        rankOf.assign(top, -1);
+        for (int r = 0; r < n; ++r) rankOf[idx[r]] = r;
+    }
+    vector<char> alive(n, 1);
+    vector<int> checked(n, -1);
+    long long calls = 0, rescored = 0;
+
+    // ѡп i ѡ j ´
+    auto rescore = [&](int i, int j) {
+        calls++;
+        double iou = IoU(cand[i], cand[j]);
+        if (!(iou > 0)) return;
+        score[j] *= soft_nms_weight(opt, iou);
+        rescored++;
+        if (score[j] < opt.score_threshold) alive[j] = 0;
+    };
+
+    vector<Box> result;
+    while (!heap.empty() && (opt.max_output <= 0 || (int)result.size() < opt.max_output)) {
+        Item top = heap.top();
+        heap.pop();
+        int i = rankOf[-top.second];
+        if (!alive[i]) continue;
+        // ֻеľɼϽ磺ھͰ·Żȥ
+        if (top.first != score[i]) {
+            heap.push(Item(score[i], top.second));
+            continue;
+        }
+        alive[i] = 0;
+        Box b = cand[i];
+        b.score = score[i];
+        result.push_back(b);
+
+        if (grid.is_large(i)) {
+            // ѡеǴֱɨһȫѡ
+            for (int j = 0; j < n; ++j) {
+                if (!alive[j]) continue;
+                if (cx2[j] < cx1[i] || cx1[j] > cx2[i] || cy2[j] < cy1[i] || cy1[j] > cy2[i]) continue;
+                rescore(i, j);
+            }
+            continue;
+        }
+        for (int y = cy1[i]; y <= cy2[i]; ++y)
+            for (int x = cx1[i]; x <= cx2[i]; ++x) {
+                size_t c = (size_t)y * W + x;
+                int *list = &cells[0] + start[c];
+                int keep = 0;
+                for (int k = 0; k < len[c]; ++k) {
+                    int j = list[k];
+                    if (!alive[j]) continue;   // ˳ְĺѡѹ
+                    list[keep++] = j;
+                    if (checked[j] == i) continue;
+                    checked[j] = i;
+                    rescore(i, j);
+                }
+                len[c] = keep;
+            }
+        size_t keep = 0;
+        for (size_t k = 0; k < large.size(); ++k) {
+            int j = large[k];
+            if (!alive[j]) continue;
+            large[keep++] = j;
+            rescore(i, j);
+        }
+        large.resize(keep);
+    }
+    if (stats) {
+        stats->iou_calls = calls;
+        stats->rescored = rescored;
+    }
+    return result;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "nms.h"
+#include "nms_soft.h"
+
+using namespace std;
+
+/*====================================================
+    Soft-NMS  / ӳȨ⣨clustered ֲ
+      1. soft_nms  soft_nms_reference ȶԣԡ˹
+      2. ֵͬ / pre_topk µӳ٣Լǰ 100 
+         벻Ԥɸ soft_nms غʡ
+      3. Ӳ NMSnms()  nms_prefiltered Ա
+    룺g++ -O2 nms_soft_bench.cpp
+====================================================*/
+
+template<typename F>
+static double timeMs(F fn) {
+    auto t0 = chrono::steady_clock::now();
+    fn();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+}
+
+static bool sameBoxes(const vector<Box> &a, const vector<Box> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].x1 != b[i].x1 || a[i].y1 != b[i].y1 || a[i].x2 != b[i].x2 ||
+            a[i].y2 != b[i].y2 || a[i].score != b[i].score)
+            return false;
+    return true;
+}
+
+static bool sameGeom(const Box &a, const Box &b) {
+    return a.x1 == b.x1 && a.y1 == b.y1 && a.x2 == b.x2 && a.y2 == b.y2;
+}
+
+// ǰ k ȷжٳ got ǰ k УԼӦ
+static double overlapTopK(const vector<Box> &exact, const vector<Box> &got, size_t k, double &maxErr) {
+    size_t m = min(k, exact.size()), hit = 0;
+    maxErr = 0;
+    for (size_t a = 0; a < m; ++a)
+        for (size_t b = 0; b < min(k, got.size()); ++b)
+            if (sameGeom(exact[a], got[b])) {
+                hit++;
+                maxErr = max(maxErr, fabs(exact[a].score - got[b].score));
+                break;
+            }
+    return m ? 100.0 * hit / m : 100.0;
+}
+
+int main() {
+    srand(2025);
+    bool allOk = true;
+    const char *names[] = {"linear", "gaussian"};
+    SoftNMSMethod methods[] = {SOFT_NMS_LINEAR, SOFT_NMS_GAUSSIAN};
+
+    printf("==== 1. soft_nms οʵֱȶԣclustered====\n");
+    int sizes[] = {1000, 10000};
+    for (int si = 0; si < 2; ++si) {
+        vector<Box> boxes = generate_clustered_boxes(sizes[si]);
+        for (int m = 0; m < 2; ++m) {
+            SoftNMSOptions opt;
+            opt.method = methods[m];
+            vector<Box> ref, got;
+            SoftNMSStats st;
+            double tr = timeMs([&] { ref = soft_nms_reference(boxes, opt); });
+            double tf = timeMs([&] { got = soft_nms(boxes, opt, &st); });
+            bool ok = sameBoxes(ref, got);
+            allOk = allOk && ok;
+            printf("N = %5d %-8s | ο %8.1f ms | + %7.1f ms (x%.1f) |  %zu | IoU %lld  ش %lld  %s\n",
+                   sizes[si], names[m], tr, tf, tr / tf, got.size(), st.iou_calls, st.rescored,
+                   ok ? "OK" : "һ");
+        }
+    }
+
+    printf("\n==== 2. Ԥɸľ / ӳ٣gaussianN = 100000Աǰ 100 ====\n");
+    vector<Box> boxes = generate_clustered_boxes(100000);
+    SoftNMSOptions base;
+    vector<Box> exact;
+    double te = timeMs([&] { exact = soft_nms(boxes, base); });
+    printf("Ԥɸ                     | %8.1f ms |  %6zu\n", te, exact.size());
+    double thrs[] = {0.001, 0.01, 0.1};
+    int topks[] = {0, 10000, 1000, 300};
+    for (int a = 0; a < 3; ++a)
+        for (int b = 0; b < 4; ++b) {
+            SoftNMSOptions opt;
+            opt.score_threshold = thrs[a];
+            opt.pre_topk = topks[b];
+            opt.max_output = 100;
+            vector<Box> got;
+            double t = timeMs([&] { got = soft_nms(boxes, opt); });
+            double err = 0;
+            double hit = overlapTopK(exact, got, 100, err);
+            printf("thr %.3f topk %5d max 100 | %8.2f ms | غ %5.1f%% |  %.2e\n", thrs[a], topks[b], t,
+                   hit, err);
+        }
+
+    printf("\n==== 3. Ӳ NMS ԤɸIoU 0.5N = 100000====\n");
+    vector<Box> hard;
+    double th = timeMs([&] { hard = nms(boxes, 0.5, "quick"); });
+    printf("nms()                      | %8.1f ms |  %zu\n", th, hard.size());
+    vector<Box> same;
+    double tp = timeMs([&] { same = nms_prefiltered(boxes, 0.5, -HUGE_VAL, 0, "quick"); });
+    bool ok = sameBoxes(hard, same);
+    allOk = allOk && ok;
+    printf("nms_prefiltered      | %8.1f ms |  %zu %s\n", tp, same.size(), ok ? "OK" : "һ");
+    for (int b = 1; b < 4; ++b) {
+        vector<Box> got;
+        double t = timeMs([&] { got = nms_prefiltered(boxes, 0.5, 0.01, topks[b], "quick"); });
+        double err = 0;
+        double hit = overlapTopK(hard, got, 100, err);
+        printf("thr 0.010 topk %5d        | %8.2f ms |  %zu | ǰ 100 غ %.1f%%\n", topks[b], t, got.size(),
+               hit);
+    }
+    return allOk ? 0 : 1;
+}
@@ -0,0 +1,193 @@
+#ifndef NMS_STREAM_H
+#define NMS_STREAM_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_simd.h"
+#include "../../MySTL/thread_pool.h"
+
+/*====================================================
+    Ƶ֡ NMS
+      ÿ֡Σ
+         : 롢ѹ򣬵õ±
+        ƶ : ϲӿװ BoxBatchSIMD ̰ơռ
+      л嶼ڹ֡ãreserve() ֮
+      ֡ٷڴ
+    StreamingNMS::process  : ִ̣߳
+    StreamingNMS::push     : ̵ֻ̳߳߳
+                              t+1 ֡ t ֡ƶͬʱܣ
+                             һ֡ĽӺһ֡
+    ʱӣseed_decay > 0һ֡Ŀ seed_decay 
+    Ϊѡ뱾֡ seed_min_score Ĳٴݣ
+    ż©ĳ֡ʱĿ겻ϡرʱ nms() ͬ
+    ͬһֻ process ֻ pushҪ
+====================================================*/
+
+// һ֡ȫ
+struct NMSFrameWorkspace {
+    vector<Box> boxes;          // ֡ + 
+    vector<uint64_t> keys, tmp;
+    vector<size_t> hist;
+    vector<int> order, merged;  // ±ꣻӺϲ±
+    int inputCount;
+    BoxBatch batch;
+    vector<uint64_t> removed;
+    vector<int> kept;
+    vector<Box> result;
+
+    NMSFrameWorkspace() : inputCount(0) {}
+
+    void reserve(size_t n) {
+        boxes.reserve(n);
+        keys.reserve(n);
+        tmp.reserve(n);
+        hist.reserve(((size_t)1 << RADIX_BITS) * RADIX_PASSES);
+        order.reserve(n);
+        merged.reserve(n);
+        size_t m = (n + 63) / 64 * 64;
+        batch.x1.reserve(m);
+        batch.y1.reserve(m);
+        batch.x2.reserve(m);
+        batch.y2.reserve(m);
+        batch.area.reserve(m);
+        batch.index.reserve(n);
+        removed.reserve(m / 64);
+        kept.reserve(n);
+        result.reserve(n);
+    }
+
+    // ȫռõֽȷ̬ûٷ
+    size_t capacity_bytes() const {
+        return boxes.capacity() * sizeof(Box) + result.capacity() * sizeof(Box) +
+               (keys.capacity() + tmp.capacity() + removed.capacity()) * sizeof(uint64_t) +
+               hist.capacity() * sizeof(size_t) +
+               (order.capacity() + merged.capacity() + kept.capacity() + batch.index.capacity()) * sizeof(int) +
+               (batch.x1.capacity() + batch.y1.capacity() + batch.x2.capacity() + batch.y2.capacity() +
+                batch.area.capacity()) * sizeof(double);
+    }
+};
+
+class StreamingNMS {
+public:
+    explicit StreamingNMS(double iouThreshold, double seedDecay = 0.0, double seedMinScore = 0.3)
+        : thr(iouThreshold), decay(seedDecay), minSeed(seedMinScore), cur(0), pending(false), stageFrame(NULL),
+          pool(2) {}
+
+    // Ԥ maxBoxes 򣨺ӣĿռ
+    void reserve(size_t maxBoxes) {
+        for (int k = 0; k < 2; ++k) slots[k].reserve(maxBoxes);
+        seeds.reserve(maxBoxes);
+    }
+
+    size_t capacity_bytes() const {
+        return slots[0].capacity_bytes() + slots[1].capacity_bytes() + seeds.capacity() * sizeof(Box);
+    }
+
+    // ̴߳һ֡صһεǰЧ
+    const vector<Box> &process(const vector<Box> &frame) {
+        NMSFrameWorkspace &ws = slots[cur];
+        sortStage(ws, frame);
+        suppressStage(ws);
+        return ws.result;
+    }
+
+    /*------------------------------------------------
+        ˮߣ֡һ֡Ʋ
+        һ֡Ľһ push ǰЧ
+        һ֡ NULL flush() ȡβ֡
+    ------------------------------------------------*/
+    const vector<Box> *push(const vector<Box> &frame) {
+        NMSFrameWorkspace &prev = slots[cur ^ 1];
+        bool hasPrev = pending;
+        if (hasPrev) {
+            // ֻ thisstd::function Ϊհڴ
+            stageFrame = &frame;
+            pool.run([this](int tid) {
+                if (tid == 0)
+                    suppressStage(slots[cur ^ 1]);
+                else
+                    sortStage(slots[cur], *stageFrame);
+            });
+        } else {
+            sortStage(slots[cur], frame);
+        }
+        pending = true;
+        cur ^= 1;
+        return hasPrev ? &prev.result : NULL;
+    }
+
+    // ȡˮһ֡Ľ
+    const vector<Box> *flush() {
+        if (!pending) return NULL;
+        NMSFrameWorkspace &prev = slots[cur ^ 1];
+        suppressStage(prev);
+        pending = false;
+        return &prev.result;
+    }
+
+private:
+    // ΣֻԼĹһƶβ
+    void sortStage(NMSFrameWorkspace &ws, const vector<Box> &frame) {
+        int n = (int)frame.size();
+        ws.boxes.assign(frame.begin(), frame.end());
+        ws.inputCount = n;
+        ws.order.resize(n);
+        if (n == 0) return;
+        int idxBits = radix_index_bits(n);
+        ws.keys.resize(n);
+        for (int i = 0; i < n; ++i) ws.keys[i] = radix_key(ws.boxes, i, idxBits);
+        radix_sort_keys(ws.keys, ws.tmp, ws.hist);
+        uint64_t mask = ((uint64_t)1 << idxBits) - 1;
+        for (int i = 0; i < n; ++i) ws.order[i] = (int)(ws.keys[i] & mask);
+        radix_fix_ties(ws.order, ws.keys, idxBits, ws.boxes);
+    }
+
+    // ƶΣӣѰ뱾֡鲢Ȼ̰
+    void suppressStage(NMSFrameWorkspace &ws) {
+        const vector<int> *order = &ws.order;
+        if (decay > 0 && !seeds.empty()) {
+            int n = ws.inputCount, s = (int)seeds.size();
+            ws.boxes.insert(ws.boxes.end(), seeds.begin(), seeds.end());
+            ws.merged.resize(n + s);
+            int a = 0, b = 0, k = 0;
+            while (a < n && b < s) {
+                if (ws.boxes[ws.order[a]].score >= seeds[b].score)
+                    ws.merged[k++] = ws.order[a++];
+                else
+                    ws.merged[k++] = n + b++;
+            }
+            while (a < n) ws.merged[k++] = ws.order[a++];
+            while (b < s) ws.merged[k++] = n + b++;
+            order = &ws.merged;
+        }
+        ws.result.clear();
+        if (!order->empty()) {
+            ws.batch.load(ws.boxes, *order);
+            ws.kept.clear();
+            nms_simd_ranks(ws.batch, thr, ws.removed, ws.kept);
+            for (size_t k = 0; k < ws.kept.size(); ++k) ws.result.push_back(ws.boxes[ws.batch.index[ws.kept[k]]]);
+        }
+        if (decay > 0) {
+            // ˥Ȼ
+            seeds.clear();
+            for (size_t k = 0; k < ws.result.size(); ++k) {
+                Box b = ws.result[k];
+                b.score *= decay;
+                if (b.score >= minSeed) seeds.push_back(b);
+            }
+        }
+    }
+
+    double thr, decay, minSeed;
+    NMSFrameWorkspace slots[2];
+    vector<Box> seeds;
+    int cur;
+    bool pending;
+    const vector<Box> *stageFrame;
+    MySTL::ThreadPool pool;
+};
+
+#endif
@@ -0,0 +1,252 @@
+#include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <new>
+#include <atomic>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+
+#include "nms.h"
+#include "nms_simd.h"
+#include "nms_stream.h"
+
+using namespace std;
+
+/*====================================================
+    Ƶ NMS600 ֡60 fps  10 룩ÿ֡Լ 5000 
+      20 ˶Ŀ꣬ÿĿÿ֡ 100~300 
+       1000 ͷӿÿĿÿ֡ 10% ʡ©족
+      ֡Ŀ 0.2
+    Աÿ֡ӳ p50 / p99
+      nms()            : ÿ֡·䣬
+      nms_simd(radix)  : ÿ֡·䣬 + SIMD 
+      process          : StreamingNMS ̣߳
+      push             : ˮߣӺһ֡
+    ȫ operator new ȷ process / push ̬
+    ʱӣͳĿĳ֡ûб >= 0.5 Ŀ򸲸ǣIoU > 0.5Ĵ
+    룺g++ -O2 -mavx2 -pthread nms_stream_bench.cpp
+====================================================*/
+
+// 滻ȫ new/delete ֻΪGCC  malloc/free Ϊƥ
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+static std::atomic<long long> g_allocs(0);
+
+void *operator new(size_t n) {
+    g_allocs++;
+    void *p = malloc(n ? n : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+static double nowMs() {
+    return chrono::duration<double, milli>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static bool sameBoxes(const vector<Box> &a, const vector<Box> &b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].x1 != b[i].x1 || a[i].y1 != b[i].y1 || a[i].x2 != b[i].x2 ||
+            a[i].y2 != b[i].y2 || a[i].score != b[i].score)
+            return false;
+    return true;
+}
+
+struct Track {
+    double x, y, vx, vy, w, h;
+};
+
+static Box trackBox(const Track &t) {
+    Box b = {t.x, t.y, t.x + t.w, t.y + t.h, 1.0};
+    return b;
+}
+
+static double frand() {
+    return (double)rand() / RAND_MAX;
+}
+
+// ȫ֡truth[f] Ϊ f ֡Ŀʵ
+static void makeVideo(int frames, vector<vector<Box> > &video, vector<vector<Box> > &truth) {
+    vector<Track> tracks(20);
+    for (size_t k = 0; k < tracks.size(); ++k) {
+        Track &t = tracks[k];
+        t.w = 60 + rand() % 120;
+        t.h = 60 + rand() % 120;
+        t.x = frand() * (1000 - t.w);
+        t.y = frand() * (1000 - t.h);
+        t.vx = frand() * 6 - 3;
+        t.vy = frand() * 6 - 3;
+    }
+    video.resize(frames);
+    truth.resize(frames);
+    for (int f = 0; f < frames; ++f) {
+        vector<Box> &boxes = video[f];
+        for (size_t k = 0; k < tracks.size(); ++k) {
+            Track &t = tracks[k];
+            t.x += t.vx;
+            t.y += t.vy;
+            if (t.x < 0 || t.x + t.w > 1000) t.vx = -t.vx, t.x += 2 * t.vx;
+            if (t.y < 0 || t.y + t.h > 1000) t.vy = -t.vy, t.y += 2 * t.vy;
+            truth[f].push_back(trackBox(t));
+            double scale = rand() % 10 == 0 ? 0.2 : 1.0;   // ©
+            int m = 100 + rand() % 201;
+            for (int j = 0; j < m; ++j) {
+                double dx = (frand() - 0.5) * 0.3 * t.w, dy = (frand() - 0.5) * 0.3 * t.h;
+                double sw = 1 + (frand() - 0.5) * 0.3, sh = 1 + (frand() - 0.5) * 0.3;
+                Box b;
+                b.x1 = t.x + dx;
+                b.y1 = t.y + dy;
+                b.x2 = b.x1 + t.w * sw;
+                b.y2 = b.y1 + t.h * sh;
+                b.score = scale * (0.6 + 0.4 * frand()) * (1 - 2 * (fabs(dx) / t.w + fabs(dy) / t.h));
+                boxes.push_back(b);
+            }
+        }
+        for (int j = 0; j < 1000; ++j) {
+            Box b = make_random_box(1000, 1000);
+            b.score *= 0.3;
+            boxes.push_back(b);
+        }
+        for (size_t i = boxes.size(); i > 1; --i) swap(boxes[i - 1], boxes[rand() % i]);
+    }
+}
+
+static void report(const char *name, vector<double> t, long long allocs) {
+    sort(t.begin(), t.end());
+    double sum = 0;
+    for (size_t i = 0; i < t.size(); ++i) sum += t[i];
+    printf("%-18s | p50 %6.3f ms | p99 %6.3f ms | ƽ %6.3f ms | ̬ %lld \n", name, t[t.size() / 2],
+           t[t.size() * 99 / 100], sum / t.size(), allocs);
+}
+
+// ж (֡, Ŀ) ûб >= 0.5 򸲸
+static int countMisses(const vector<vector<Box> > &out, const vector<vector<Box> > &truth) {
+    int miss = 0;
+    for (size_t f = 0; f < truth.size(); ++f)
+        for (size_t k = 0; k < truth[f].size(); ++k) {
+            bool hit = false;
+            for (size_t j = 0; j < out[f].size() && !hit; ++j)
+                hit = out[f][j].score >= 0.5 && IoU(out[f][j], truth[f][k]) > 0.5;
+            miss += !hit;
+        }
+    return miss;
+}
+
+int main() {
+    srand(2025);
+    const int frames = 600, warm = 10;
+    const double thr = 0.5;
+    vector<vector<Box> > video, truth;
+    makeVideo(frames, video, truth);
+    size_t maxBoxes = 0;
+    for (int f = 0; f < frames; ++f) maxBoxes = max(maxBoxes, video[f].size());
+    bool allOk = true;
+
+    printf("==== Ƶ NMS%d ֡ÿ֡ %zu ں %s====\n", frames, maxBoxes, nms_simd_kernel_name());
+
+    vector<vector<Box> > ref(frames);
+    vector<double> t(frames);
+    long long allocs = 0;
+    for (int f = 0; f < frames; ++f) {
+        long long a0 = g_allocs;
+        double t0 = nowMs();
+        ref[f] = nms(video[f], thr, "quick");
+        t[f] = nowMs() - t0;
+        if (f >= warm) allocs += g_allocs - a0;
+    }
+    report("nms()", t, allocs);
+
+    {
+        bool ok = true;
+        allocs = 0;
+        for (int f = 0; f < frames; ++f) {
+            long long a0 = g_allocs;
+            double t0 = nowMs();
+            vector<Box> r = nms_simd(video[f], thr, "radix");
+            t[f] = nowMs() - t0;
+            if (f >= warm) allocs += g_allocs - a0;
+            ok = ok && sameBoxes(r, ref[f]);
+        }
+        allOk = allOk && ok;
+        report("nms_simd(radix)", t, allocs);
+        printf("   nms() %s\n", ok ? "һ" : "һ");
+    }
+
+    {
+        StreamingNMS s(thr);
+        s.reserve(maxBoxes);
+        size_t cap = s.capacity_bytes();
+        bool ok = true;
+        allocs = 0;
+        for (int f = 0; f < frames; ++f) {
+            long long a0 = g_allocs;
+            double t0 = nowMs();
+            const vector<Box> &r = s.process(video[f]);
+            t[f] = nowMs() - t0;
+            if (f >= warm) allocs += g_allocs - a0;
+            ok = ok && sameBoxes(r, ref[f]);
+        }
+        ok = ok && cap == s.capacity_bytes();
+        allOk = allOk && ok;
+        report("process", t, allocs);
+        printf("   nms() %s %.1f MB δ\n", ok ? "һ" : "һ", cap / 1048576.0);
+    }
+
+    {
+        StreamingNMS s(thr);
+        s.reserve(maxBoxes);
+        bool ok = true;
+        allocs = 0;
+        vector<double> tp;
+        for (int f = 0; f <= frames; ++f) {
+            long long a0 = g_allocs;
+            double t0 = nowMs();
+            const vector<Box> *r = f < frames ? s.push(video[f]) : s.flush();
+            double dt = nowMs() - t0;
+            if (f >= warm) allocs += g_allocs - a0;
+            if (f > 0) {
+                tp.push_back(dt);
+                ok = ok && r && sameBoxes(*r, ref[f - 1]);
+            }
+        }
+        allOk = allOk && ok;
+        report("pushˮߣ", tp, allocs);
+        printf("   nms() %sÿ push ĺʱ̬ÿ֡ʱӺһ֡\n", ok ? "һ" : "һ");
+    }
+
+    printf("\n-- ʱӣ©֡Ŀ긲ǣ--\n");
+    int base = countMisses(ref, truth);
+    printf("              | δ %d / %d\n", base, frames * 20);
+    double decays[] = {0.6, 0.8, 0.9};
+    for (int d = 0; d < 3; ++d) {
+        StreamingNMS s(thr, decays[d], 0.3);
+        s.reserve(maxBoxes + 256);
+        vector<vector<Box> > out(frames);
+        allocs = 0;
+        for (int f = 0; f < frames; ++f) {
+            long long a0 = g_allocs;
+            double t0 = nowMs();
+            const vector<Box> &r = s.process(video[f]);
+            t[f] = nowMs() - t0;
+            if (f >= warm) allocs += g_allocs - a0;
+            out[f] = r;   // ڼ֮
+        }
+        int miss = countMisses(out, truth);
+        char name[64];
+        snprintf(name, sizeof(name), " decay %.1f", decays[d]);
+        report(name, t, allocs);
+        printf("  δ %d / %d\n", miss, frames * 20);
+    }
+    return allOk ? 0 : 1;
+}